@@ -9,86 +9,57 @@ const fileName = process.argv[2];
 
 const header = fs.readFileSync(`${__dirname}/unicode-header.txt`);
 
+const CHAR_COUNT = 0x10000;
+
 const file = {
     contents: header,
     write: function(cnt) {
         this.contents += cnt;
     },
     writeLine: function(cnt = "") { this.write(cnt + "\n"); },
-    writeSwitch: function(map, name, param, action, retType = "void", defaultAction = () => action("ch")) {
-        const strCmp = (a, b) => a < b ? -1 : (b > a ? 1 : 0);
-        const codePointToCharLiteral = (codepoint) => `u'\\u${codepoint}'`;
-
-        let arr = [];
-        for (const key in map) {
-            arr.push({ key: key, value: map[key] });
+    writeArray: function(type, name, values, toLiteral = (v) => v.toString(), perLine = 16) {
+        this.writeLine(`static constexpr ${type} ${name}[] = {`);
+        for (let i = 0; i < values.length; i += perLine) {
+            this.writeLine("    " + values.slice(i, i + perLine).map(toLiteral).join(", ") + ",");
         }
-        arr.sort((a, b) => strCmp(a.value[0], b.value[0]));
-
-        const INDENT = "    ";
-        const optionalParam = param.length !== 0 ? (param + ", ") : "";
-        this.writeLine(`${retType} Unicode::${name}(${optionalParam}char16 ch) {`);
-        this.writeLine(`${INDENT}switch (ch) {`);
-        for (const mapping of arr) {
-            let first = true;
-            for (const mappedChar of mapping.value.sort(strCmp)) {
-                if (first) { first = false; }
-                else { this.writeLine(" [[fallthrough]];"); }
-                this.write(`${INDENT.repeat(2)}case ${codePointToCharLiteral(mappedChar)}:`);
-            }
-            this.writeLine(" {");
-            for (const mapped of mapping.key.split(" ")) {
-                this.writeLine(INDENT.repeat(3) + action(codePointToCharLiteral(mapped)));
-            }
-            this.writeLine(`${INDENT.repeat(2)}} break;`);
-        }
-        this.writeLine(`${INDENT.repeat(2)}default: {`);
-        this.writeLine(INDENT.repeat(3) + defaultAction());
-        this.writeLine(`${INDENT.repeat(2)}} break;`);
-    
-        this.writeLine(INDENT + "}");
-        this.writeLine("}");
+        this.writeLine("};");
     }
 };
 
-class Caser {
-    #cases = {};
-    #hasHad = new Set();
+const hex = (v) => "0x" + v.toString(16).toUpperCase().padStart(4, "0");
+const parseChars = (str) => str.trim().split(" ").map((c) => parseInt(c, 16));
+
+// Maps single characters to sequences of characters.
+class Mapping {
+    #map = new Map();
     feed(from, to) {
         from = from.trim();
         to = to.trim();
         if (to.length === 0 || from === to) { return; }
         // First come, first served
-        if (!this.#hasHad.has(from)) {
-            this.#hasHad.add(from);
-            this.#cases[to] ??= [];
-            this.#cases[to].push(from);
+        const fromChar = parseInt(from, 16);
+        if (!this.#map.has(fromChar)) {
+            this.#map.set(fromChar, parseChars(to));
         }
     }
-    write(file, name) {
-        file.writeSwitch(this.#cases, name, "String& str", (ch) => `str += ${ch};`);
-    }
+    get(ch) { return this.#map.get(ch); }
 }
 
-let map = {};
+const fold = new Mapping();
 parseUnicode("https://www.unicode.org/Public/UCD/latest/ucd/CaseFolding.txt", (params) => {
-    // It's full/multi-char folding or not yet folded!
-    params[0] = params[0].trim();
-    params[2] = params[2].trim();
-    if (params[0] !== params[2] && (params[1].trim() === "F" || !(params[0] in map))) {
-        map[params[0]] = params[2];
+    // Full/multi-char folding takes precedence over simple folding, Turkic folding is never used.
+    if (params[1].trim() === "F") {
+        fold.feed(params[0], params[2]);
+    }
+});
+parseUnicode("https://www.unicode.org/Public/UCD/latest/ucd/CaseFolding.txt", (params) => {
+    if (params[1].trim() !== "F") {
+        fold.feed(params[0], params[2]);
     }
 });
-let flipMap = {};
-for (const key in map) {
-    flipMap[map[key]] ??= [];
-    flipMap[map[key]].push(key);
-}
-file.writeSwitch(flipMap, "fold", "CircularArray<char16>& queue", (ch) => `queue.pushBack(${ch});`);
-file.writeLine();
 
-const up = new Caser();
-const down = new Caser();
+const up = new Mapping();
+const down = new Mapping();
 // MANUAL OVERRIDE
 up.feed("00DF", "1E9E");
 //
@@ -99,20 +70,186 @@ parseUnicode("https://unicode.org/Public/UNIDATA/SpecialCasing.txt", (params) =>
     down.feed(params[0], params[1]);
 });
 
-let spaceIdent = [];
+const SPACE = 1 << 0;
+const DIGIT = 1 << 1;
+const FOLD_SEQUENCE = 1 << 2;
+const UP_SEQUENCE = 1 << 3;
+const DOWN_SEQUENCE = 1 << 4;
+
+const flags = new Array(CHAR_COUNT).fill(0);
 parseUnicode("https://unicode.org/Public/UNIDATA/UnicodeData.txt", (params) => {
     up.feed(params[0], params[12]);
     down.feed(params[0], params[13]);
     if (params[2][0] === "Z" || params[2] === "Cc") {
-        spaceIdent.push(params[0]);
+        flags[parseInt(params[0], 16)] |= SPACE;
     }
 });
+// Only ASCII digits, number parsing relies on them being contiguous from '0'.
+for (let ch = 0x30; ch <= 0x39; ch++) {
+    flags[ch] |= DIGIT;
+}
+
+// Single character mappings are stored as the difference to the original character, so that they are shared between many characters.
+// Longer ones go into SEQUENCES, terminated by a null character.
+const sequences = [];
+const sequenceOffsets = new Map();
+const encodeMapping = (ch, mapped, sequenceFlag) => {
+    if (mapped === undefined) { return [0, 0]; }
+    if (mapped.length === 1) { return [(mapped[0] - ch + CHAR_COUNT) % CHAR_COUNT, 0]; }
+    const key = mapped.join(" ");
+    if (!sequenceOffsets.has(key)) {
+        sequenceOffsets.set(key, sequences.length);
+        sequences.push(...mapped, 0);
+    }
+    return [sequenceOffsets.get(key), sequenceFlag];
+};
+
+const infos = [];
+const infoIndices = new Map();
+const charInfos = new Array(CHAR_COUNT);
+for (let ch = 0; ch < CHAR_COUNT; ch++) {
+    const [foldValue, foldFlag] = encodeMapping(ch, fold.get(ch), FOLD_SEQUENCE);
+    const [upValue, upFlag] = encodeMapping(ch, up.get(ch), UP_SEQUENCE);
+    const [downValue, downFlag] = encodeMapping(ch, down.get(ch), DOWN_SEQUENCE);
+    const info = [flags[ch] | foldFlag | upFlag | downFlag, foldValue, upValue, downValue];
+    const key = info.join(" ");
+    if (!infoIndices.has(key)) {
+        infoIndices.set(key, infos.length);
+        infos.push(info);
+    }
+    charInfos[ch] = infoIndices.get(key);
+}
+
+// Two stage table: the characters are split into blocks, identical blocks are only stored once.
+const typeFor = (max) => max < 0x100 ? "u8" : (max < 0x10000 ? "u16" : "u32");
+const sizeOf = (type) => ({ u8: 1, u16: 2, u32: 4 })[type];
+let best = null;
+for (let shift = 4; shift <= 10; shift++) {
+    const blockSize = 1 << shift;
+    const blocks = [];
+    const blockIndices = new Map();
+    const indices = [];
+    for (let start = 0; start < CHAR_COUNT; start += blockSize) {
+        const block = charInfos.slice(start, start + blockSize);
+        const key = block.join(" ");
+        if (!blockIndices.has(key)) {
+            blockIndices.set(key, blocks.length);
+            blocks.push(block);
+        }
+        indices.push(blockIndices.get(key));
+    }
+    const indexType = typeFor(blocks.length - 1);
+    const dataType = typeFor(infos.length - 1);
+    const size = indices.length * sizeOf(indexType) + blocks.length * blockSize * sizeOf(dataType);
+    if (best === null || size < best.size) {
+        best = { shift, indices, data: blocks.flat(), indexType, dataType, size };
+    }
+}
 
-up.write(file, "up");
+// FNV-1a over the properties and the folded, upper and lower case of every character.
+// The tests hash the same through the public functions, which checks the tables against the data they were generated from.
+const FNV_PRIME = 0x100000001B3n;
+let digest = 0xCBF29CE484222325n;
+const feedDigest = (b) => { digest = ((digest ^ BigInt(b)) * FNV_PRIME) & 0xFFFFFFFFFFFFFFFFn; };
+for (let ch = 0; ch < CHAR_COUNT; ch++) {
+    feedDigest(flags[ch] & (SPACE | DIGIT));
+    // The null character and the noncharacters at the end can't be put into a string.
+    if (ch === 0 || ch >= 0xFFFE) { continue; }
+    for (const mapping of [fold, up, down]) {
+        for (const unit of [...(mapping.get(ch) ?? [ch]), 0]) {
+            feedDigest(unit & 0xFF);
+            feedDigest(unit >> 8);
+        }
+    }
+}
+
+file.writeLine(`static constexpr u8 SPACE = ${SPACE};`);
+file.writeLine(`static constexpr u8 DIGIT = ${DIGIT};`);
+file.writeLine(`static constexpr u8 FOLD_SEQUENCE = ${FOLD_SEQUENCE};`);
+file.writeLine(`static constexpr u8 UP_SEQUENCE = ${UP_SEQUENCE};`);
+file.writeLine(`static constexpr u8 DOWN_SEQUENCE = ${DOWN_SEQUENCE};`);
+file.writeLine();
+file.writeLine("// Case mappings are added to the character, unless the matching sequence flag is set.");
+file.writeLine("// In that case they are an offset into SEQUENCES, where the mapping is stored terminated by a null character.");
+file.writeLine("struct CharInfo {");
+file.writeLine("    u8 flags;");
+file.writeLine("    u16 fold;");
+file.writeLine("    u16 up;");
+file.writeLine("    u16 down;");
+file.writeLine("};");
 file.writeLine();
-down.write(file, "down");
+file.writeLine(`static constexpr int BLOCK_SHIFT = ${best.shift};`);
+file.writeLine("static constexpr int BLOCK_MASK = (1 << BLOCK_SHIFT) - 1;");
 file.writeLine();
-file.writeSwitch({spaceIdent}, "isSpace", "", () => "return true;", "bool", () => "return false;");
+file.writeArray("char16", "SEQUENCES", sequences, hex);
+file.writeLine();
+file.writeArray("CharInfo", "CHAR_INFOS", infos, (info) => `{ ${info[0]}, ${hex(info[1])}, ${hex(info[2])}, ${hex(info[3])} }`, 4);
+file.writeLine();
+file.writeLine("// Indexed by the upper bits of a character, the blocks of BLOCK_DATA are indexed by the lower bits.");
+file.writeArray(best.indexType, "BLOCK_INDICES", best.indices);
+file.writeLine();
+file.writeArray(best.dataType, "BLOCK_DATA", best.data);
+file.writeLine();
+file.writeLine(`static_assert(sizeof(BLOCK_INDICES) / sizeof(*BLOCK_INDICES) == ${CHAR_COUNT} >> BLOCK_SHIFT);`);
+file.writeLine();
+file.writeLine(`const u64 Unicode::TABLE_DIGEST = 0x${digest.toString(16).toUpperCase().padStart(16, "0")}u;`);
+file.writeLine();
+file.write(`static const CharInfo& getInfo(char16 ch) {
+    return CHAR_INFOS[BLOCK_DATA[(BLOCK_INDICES[ch >> BLOCK_SHIFT] << BLOCK_SHIFT) | (ch & BLOCK_MASK)]];
+}
+
+void Unicode::fold(CircularArray<char16>& queue, char16 ch) {
+    const CharInfo& info = getInfo(ch);
+    if ((info.flags & FOLD_SEQUENCE) == 0) {
+        queue.pushBack((char16)(ch + info.fold));
+        return;
+    }
+    for (const char16* seq = SEQUENCES + info.fold; *seq != 0; seq++) {
+        queue.pushBack(*seq);
+    }
+}
+
+void Unicode::fold(StringBuilder& str, char16 ch) {
+    const CharInfo& info = getInfo(ch);
+    if ((info.flags & FOLD_SEQUENCE) == 0) {
+        str += (char16)(ch + info.fold);
+        return;
+    }
+    for (const char16* seq = SEQUENCES + info.fold; *seq != 0; seq++) {
+        str += *seq;
+    }
+}
+
+void Unicode::up(StringBuilder& str, char16 ch) {
+    const CharInfo& info = getInfo(ch);
+    if ((info.flags & UP_SEQUENCE) == 0) {
+        str += (char16)(ch + info.up);
+        return;
+    }
+    for (const char16* seq = SEQUENCES + info.up; *seq != 0; seq++) {
+        str += *seq;
+    }
+}
+
+void Unicode::down(StringBuilder& str, char16 ch) {
+    const CharInfo& info = getInfo(ch);
+    if ((info.flags & DOWN_SEQUENCE) == 0) {
+        str += (char16)(ch + info.down);
+        return;
+    }
+    for (const char16* seq = SEQUENCES + info.down; *seq != 0; seq++) {
+        str += *seq;
+    }
+}
+
+bool Unicode::isSpace(char16 ch) {
+    return (getInfo(ch).flags & SPACE) != 0;
+}
+
+bool Unicode::isDigit(char16 ch) {
+    return (getInfo(ch).flags & DIGIT) != 0;
+}
+`);
 fs.writeFileSync(fileName, file.contents);
 
 console.log("Generated Unicode code!");
@@ -40,11 +40,11 @@ class Program {
 
             vertexData = StructuredData(shader->getVertexLayout(), 5);
             
-            vertexData.setValue(0, "position", Vector4f(-1.f, -1.f, 0.f, 1.f));
-            vertexData.setValue(1, "position", Vector4f(-1.f, 1.f, 0.f, 1.f));
-            vertexData.setValue(2, "position", Vector4f(1.f, 1.f, 0.f, 1.f));
-            vertexData.setValue(3, "position", Vector4f(1.f, -1.f, 0.f, 1.f));
-            vertexData.setValue(4, "position", Vector4f(0.f, 0.f, 0.f, 1.f));
+            vertexData.setValue(0, "position"_key, Vector4f(-1.f, -1.f, 0.f, 1.f));
+            vertexData.setValue(1, "position"_key, Vector4f(-1.f, 1.f, 0.f, 1.f));
+            vertexData.setValue(2, "position"_key, Vector4f(1.f, 1.f, 0.f, 1.f));
+            vertexData.setValue(3, "position"_key, Vector4f(1.f, -1.f, 0.f, 1.f));
+            vertexData.setValue(4, "position"_key, Vector4f(0.f, 0.f, 0.f, 1.f));
 
             triangles.emplace_back(1, 0, 4);
             triangles.emplace_back(2, 1, 4);
@@ -85,18 +85,18 @@ class Program {
             state += 3.f;
 
             Color color0 = Color::fromHSV(state, 1.f, 1.f, 1.f);
-            vertexData.setValue(0, "color", color0);
+            vertexData.setValue(0, "color"_key, color0);
             Color color1 = Color::fromHSV(state+90.f, 1.f, 1.f, 1.f);
-            vertexData.setValue(1, "color", color1);
+            vertexData.setValue(1, "color"_key, color1);
             Color color2 = Color::fromHSV(state+180.f, 1.f, 1.f, 1.f);
-            vertexData.setValue(2, "color", color2);
+            vertexData.setValue(2, "color"_key, color2);
             Color color3 = Color::fromHSV(state+270.f, 1.f, 1.f, 1.f);
-            vertexData.setValue(3, "color", color3);
+            vertexData.setValue(3, "color"_key, color3);
             Color color4 = Color::lerp(
                 Color::lerp(color0, color1, 0.5f),
                 Color::lerp(color2, color3, 0.5f),
                 0.5f);
-            vertexData.setValue(4, "color", color4);
+            vertexData.setValue(4, "color"_key, color4);
 
             mesh->setGeometry(vertexData.copy(), triangles);
 
@@ -55,24 +55,24 @@ class Program {
             vertexPositions[4] = Vector4f(0.f, 0.f, 0.f, 1.f);
 
             for (int i = 0; i < 5; i++) {
-                vertexDataGpuTransform.setValue(i, "position", vertexPositions[i]);
+                vertexDataGpuTransform.setValue(i, "position"_key, vertexPositions[i]);
             }
 
-            vertexDataGpuTransform.setValue(0, "color", Colors::GREEN);
-            vertexDataGpuTransform.setValue(1, "color", Colors::RED);
-            vertexDataGpuTransform.setValue(2, "color", Colors::RED);
-            vertexDataGpuTransform.setValue(3, "color", Colors::GREEN);
-            vertexDataGpuTransform.setValue(4, "color", Colors::WHITE);
+            vertexDataGpuTransform.setValue(0, "color"_key, Colors::GREEN);
+            vertexDataGpuTransform.setValue(1, "color"_key, Colors::RED);
+            vertexDataGpuTransform.setValue(2, "color"_key, Colors::RED);
+            vertexDataGpuTransform.setValue(3, "color"_key, Colors::GREEN);
+            vertexDataGpuTransform.setValue(4, "color"_key, Colors::WHITE);
 
             vertexDataCpuTransform = vertexDataGpuTransform.copy();
 
             Color blue = Colors::BLUE; blue.alpha = 0.5f;
             Color white = Colors::WHITE; white.alpha = 0.5f;
-            vertexDataCpuTransform.setValue(0, "color", blue);
-            vertexDataCpuTransform.setValue(1, "color", blue);
-            vertexDataCpuTransform.setValue(2, "color", blue);
-            vertexDataCpuTransform.setValue(3, "color", blue);
-            vertexDataCpuTransform.setValue(4, "color", white);
+            vertexDataCpuTransform.setValue(0, "color"_key, blue);
+            vertexDataCpuTransform.setValue(1, "color"_key, blue);
+            vertexDataCpuTransform.setValue(2, "color"_key, blue);
+            vertexDataCpuTransform.setValue(3, "color"_key, blue);
+            vertexDataCpuTransform.setValue(4, "color"_key, white);
 
             triangles.emplace_back(0, 1, 4);
             triangles.emplace_back(1, 2, 4);
@@ -140,19 +140,19 @@ class Program {
 
             graphics->clear(Colors::BLACK);
 
-            shader->getVertexShaderConstant("worldMatrix")->setValue(worldMatrix);
-            shader->getVertexShaderConstant("viewMatrix")->setValue(viewMatrix);
-            shader->getVertexShaderConstant("projectionMatrix")->setValue(projectionMatrix);
+            shader->getVertexShaderConstant("worldMatrix"_key)->setValue(worldMatrix);
+            shader->getVertexShaderConstant("viewMatrix"_key)->setValue(viewMatrix);
+            shader->getVertexShaderConstant("projectionMatrix"_key)->setValue(projectionMatrix);
             mesh->setGeometry(vertexDataGpuTransform.copy(), triangles);
             mesh->render();
 
             for (int i = 0; i < 5; i++) {
-                vertexDataCpuTransform.setValue(i, "position", stackedMatrices.transform(vertexPositions[i]));
+                vertexDataCpuTransform.setValue(i, "position"_key, stackedMatrices.transform(vertexPositions[i]));
             }
 
-            shader->getVertexShaderConstant("worldMatrix")->setValue(Matrices::IDENTITY);
-            shader->getVertexShaderConstant("viewMatrix")->setValue(Matrices::IDENTITY);
-            shader->getVertexShaderConstant("projectionMatrix")->setValue(Matrices::IDENTITY);
+            shader->getVertexShaderConstant("worldMatrix"_key)->setValue(Matrices::IDENTITY);
+            shader->getVertexShaderConstant("viewMatrix"_key)->setValue(Matrices::IDENTITY);
+            shader->getVertexShaderConstant("projectionMatrix"_key)->setValue(Matrices::IDENTITY);
             mesh->setGeometry(vertexDataCpuTransform.copy(), triangles);
             mesh->render();
 
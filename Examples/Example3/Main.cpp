@@ -74,14 +74,14 @@ class Program {
             mesh = Mesh::create(*graphics);
             shader = Shader::load(*graphics, FilePath::fromStr("Shader3"));
             StructuredData vertices(shader->getVertexLayout(), 4);
-            vertices.setValue(0, "position", Vector2f(0, 0));
-            vertices.setValue(1, "position", Vector2f(1, 0));
-            vertices.setValue(2, "position", Vector2f(0, 1));
-            vertices.setValue(3, "position", Vector2f(1, 1));
-            vertices.setValue(0, "color", Colors::RED);
-            vertices.setValue(1, "color", Colors::GREEN);
-            vertices.setValue(2, "color", Colors::GREEN);
-            vertices.setValue(3, "color", Colors::BLUE);
+            vertices.setValue(0, "position"_key, Vector2f(0, 0));
+            vertices.setValue(1, "position"_key, Vector2f(1, 0));
+            vertices.setValue(2, "position"_key, Vector2f(0, 1));
+            vertices.setValue(3, "position"_key, Vector2f(1, 1));
+            vertices.setValue(0, "color"_key, Colors::RED);
+            vertices.setValue(1, "color"_key, Colors::GREEN);
+            vertices.setValue(2, "color"_key, Colors::GREEN);
+            vertices.setValue(3, "color"_key, Colors::BLUE);
             mat = Material::create(*graphics, *shader, Opaque::NO);
             mesh->setMaterial(mat);
             mesh->setGeometry(std::move(vertices), PrimitiveType::TRIANGLE, { 0, 1, 2, 1, 2, 3 });
@@ -100,14 +100,14 @@ class Program {
             tex = Texture::load(*graphics, dim, dim, bytes.data() + headerOffset, Texture::Format::RGBA32);
             
             vertices = StructuredData(shader2->getVertexLayout(), 4);
-            vertices.setValue(0, "position", Vector2f(0, 0));
-            vertices.setValue(1, "position", Vector2f(-1, 0));
-            vertices.setValue(2, "position", Vector2f(0, -1));
-            vertices.setValue(3, "position", Vector2f(-1, -1));
-            vertices.setValue(0, "uv", Vector2f(0, 1));
-            vertices.setValue(1, "uv", Vector2f(1, 1));
-            vertices.setValue(2, "uv", Vector2f(0, 0));
-            vertices.setValue(3, "uv", Vector2f(1, 0));
+            vertices.setValue(0, "position"_key, Vector2f(0, 0));
+            vertices.setValue(1, "position"_key, Vector2f(-1, 0));
+            vertices.setValue(2, "position"_key, Vector2f(0, -1));
+            vertices.setValue(3, "position"_key, Vector2f(-1, -1));
+            vertices.setValue(0, "uv"_key, Vector2f(0, 1));
+            vertices.setValue(1, "uv"_key, Vector2f(1, 1));
+            vertices.setValue(2, "uv"_key, Vector2f(0, 0));
+            vertices.setValue(3, "uv"_key, Vector2f(1, 0));
 
             tex = load(FilePath::fromStr("logo.bmp"));
             mat2 = Material::create(*graphics, *shader2, *tex, Opaque::YES);
@@ -126,14 +126,14 @@ class Program {
             mat4 = Material::create(*graphics, *shader4, ReferenceVector<Texture>{ *tex, *tex2 }, Opaque::YES);
 
             vertices = StructuredData(shader4->getVertexLayout(), 4);
-            vertices.setValue(0, "position", Vector2f(0, 0));
-            vertices.setValue(1, "position", Vector2f(1, 0));
-            vertices.setValue(2, "position", Vector2f(0, -1));
-            vertices.setValue(3, "position", Vector2f(1, -1));
-            vertices.setValue(0, "uv", Vector2f(0, 1));
-            vertices.setValue(1, "uv", Vector2f(1, 1));
-            vertices.setValue(2, "uv", Vector2f(0, 0));
-            vertices.setValue(3, "uv", Vector2f(1, 0));
+            vertices.setValue(0, "position"_key, Vector2f(0, 0));
+            vertices.setValue(1, "position"_key, Vector2f(1, 0));
+            vertices.setValue(2, "position"_key, Vector2f(0, -1));
+            vertices.setValue(3, "position"_key, Vector2f(1, -1));
+            vertices.setValue(0, "uv"_key, Vector2f(0, 1));
+            vertices.setValue(1, "uv"_key, Vector2f(1, 1));
+            vertices.setValue(2, "uv"_key, Vector2f(0, 0));
+            vertices.setValue(3, "uv"_key, Vector2f(1, 0));
             mesh4->setMaterial(mat4);
             mesh4->setGeometry(std::move(vertices), PrimitiveType::TRIANGLE, { 2, 1, 0, 3, 2, 1 });
         }
@@ -1,6 +1,8 @@
 #ifndef PGE_TEXTREADER_H_INCLUDED
 #define PGE_TEXTREADER_H_INCLUDED
 
+#include <vector>
+
 #include <PGE/File/AbstractIO.h>
 
 namespace PGE {
@@ -36,6 +38,7 @@ class TextReader : private AbstractIO<std::ifstream> {
 
         /// Reads a line and returns it.
         /// `\n`, `\r`, `\n\r` and `\r\n` are considered to be line endings.
+        /// @throws #PGE::Exception if the line is not well-formed UTF-8 when reading UTF-8.
         String readLine();
         /// Reads a line into the given string.
         /// This can be used in combination with the property of strings to never contract their internal capacity in order to avoid
@@ -45,7 +48,14 @@ class TextReader : private AbstractIO<std::ifstream> {
     private:
         Encoding encoding;
         bool eof = false;
+        // Reused between lines to avoid allocating.
+        std::vector<char> lineBytes;
+        std::vector<char16> lineUnits;
 
+        void readUtf8Line(String& dest);
+        /// @param[out] bytesRead Less than 2 if the end of file was reached.
+        char16 readUtf16Unit(std::streambuf* buf, int& bytesRead);
+        void readUtf16Line(String& dest);
         char16 readChar();
         void spitOut(char16 ch);
 
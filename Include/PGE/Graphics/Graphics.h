@@ -6,6 +6,7 @@
 
 #include <PGE/ResourceManagement/ResourceManager.h>
 #include <PGE/Types/PolymorphicHeap.h>
+#include <PGE/Types/SmallVector.h>
 #include <PGE/SysEvents/SysEvents.h>
 #include <PGE/Math/Rectangle.h>
 #include <PGE/Color/Color.h>
@@ -3,6 +3,7 @@
 
 #include <PGE/Types/Types.h>
 #include <PGE/Types/PolymorphicHeap.h>
+#include <PGE/Types/SmallVector.h>
 
 namespace PGE {
 
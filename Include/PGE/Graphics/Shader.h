@@ -30,8 +30,10 @@ class Shader : private PolymorphicHeap {
 
                 virtual void setValueInternal(const std::span<byte>& data) = 0;
         };
-        virtual Constant* getVertexShaderConstant(const String& constName) = 0;
-        virtual Constant* getFragmentShaderConstant(const String& constName) = 0;
+        Constant* getVertexShaderConstant(const String& constName) { return getVertexShaderConstant(String::Key(constName)); }
+        Constant* getFragmentShaderConstant(const String& constName) { return getFragmentShaderConstant(String::Key(constName)); }
+        virtual Constant* getVertexShaderConstant(const String::Key& constName) = 0;
+        virtual Constant* getFragmentShaderConstant(const String::Key& constName) = 0;
 
         int getTextureCount() const { PGE_ASSERT(textureCount != -1, "Texture count has not been initialized"); return textureCount; }
 
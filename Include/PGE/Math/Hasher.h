@@ -2,33 +2,205 @@
 #define PGE_HASHER_H_INCLUDED
 
 #include <span>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+#include <PGE/Types/Types.h>
 
 namespace PGE {
 
-// FNV-1a
-// Public domain
+/// Streaming 64-bit hash in the style of wyhash, consuming 32 bytes per step.
+/// Only depends on the sequence of bytes fed, not on how it was split into calls.
+/// Integers are fed in little-endian byte order, the result is the same at compile time and at runtime.
 class Hasher {
 	public:
 		constexpr void feed(std::integral auto value) {
-			hash ^= value;
-			hash *= 0x00000100000001b3u;
+			if (std::is_constant_evaluated()) {
+				for (size_t i = 0; i < sizeof(value); i++) {
+					feedByte((byte)((u64)value >> (i * 8)));
+				}
+			} else {
+				feedBytes((const byte*)&value, sizeof(value));
+			}
+		}
+
+		template <std::integral T, size_t EXTENT>
+		constexpr void feed(const std::span<T, EXTENT>& data) {
+			if (std::is_constant_evaluated()) {
+				for (T t : data) {
+					feed(t);
+				}
+			} else {
+				feedBytes((const byte*)data.data(), data.size_bytes());
+			}
 		}
 
 		constexpr u64 getHash() const {
-			return hash;
+			return finish(lanes[0], lanes[1], length, buffer);
 		}
 
-		template <std::integral T>
-		static constexpr u64 getHash(const std::span<T>& data) {
-			Hasher hasher;
-			for (T t : data) {
-				hasher.feed(t);
+		template <std::integral T, size_t EXTENT>
+		static constexpr u64 getHash(const std::span<T, EXTENT>& data) {
+			if (std::is_constant_evaluated()) {
+				Hasher hasher;
+				hasher.feed(data);
+				return hasher.getHash();
 			}
-			return hasher.getHash();
+
+			// Same as feeding, but without going through the buffer.
+			const byte* bytes = (const byte*)data.data();
+			u64 size = data.size_bytes();
+			u64 state[2] = { INITIAL_LANES[0], INITIAL_LANES[1] };
+			for (u64 i = STRIPE_SIZE; i <= size; i += STRIPE_SIZE) {
+				consumeStripe(state, bytes);
+				bytes += STRIPE_SIZE;
+			}
+			return finish(state[0], state[1], size, bytes);
+		}
+
+		/// Progress of hashing a buffer that is only ever appended to, covering the whole stripes at its start.
+		struct Prefix {
+			u64 lanes[2] = { INITIAL_LANES[0], INITIAL_LANES[1] };
+			u64 length = 0;
+		};
+
+		/// Extends prefix to cover all of data except for its last incomplete stripe.
+		/// The bytes already covered by prefix must not have changed since.
+		static void advance(std::span<const byte> data, Prefix& prefix) {
+			for (u64 i = prefix.length + STRIPE_SIZE; i <= data.size(); i += STRIPE_SIZE) {
+				consumeStripe(prefix.lanes, data.data() + i - STRIPE_SIZE);
+			}
+			prefix.length = data.size() - data.size() % STRIPE_SIZE;
+		}
+
+		/// Equal to #getHash(data), but skips the bytes covered by prefix, which must not have changed since.
+		/// prefix is taken by value, so a prefix shared between threads is only ever read.
+		static u64 getHash(std::span<const byte> data, Prefix prefix) {
+			advance(data, prefix);
+			return finish(prefix.lanes[0], prefix.lanes[1], data.size(), data.data() + prefix.length);
 		}
 
 	private:
-		u64 hash = 0xcbf29ce484222325;
+		static constexpr int STRIPE_SIZE = 32;
+		static constexpr u64 SECRET[] = { 0xa0761d6478bd642fu, 0xe7037ed1a0b428dbu, 0x8ebc6af09c88c6e3u, 0x589965cc75374cc3u };
+
+		static constexpr u64 INITIAL_LANES[] = { SECRET[0], SECRET[3] };
+
+		u64 lanes[2] = { INITIAL_LANES[0], INITIAL_LANES[1] };
+		u64 length = 0;
+		// Holds the bytes of the incomplete stripe, always the first length % STRIPE_SIZE.
+		byte buffer[STRIPE_SIZE] { };
+
+		// Full 128-bit product of a and b, folded down to 64 bits.
+		static constexpr u64 mix(u64 a, u64 b) {
+#if defined(__SIZEOF_INT128__)
+			unsigned __int128 product = (unsigned __int128)a * b;
+			return (u64)product ^ (u64)(product >> 64);
+#else
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+			if (!std::is_constant_evaluated()) {
+				return (a * b) ^ __umulh(a, b);
+			}
+#endif
+			u64 aLow = (u32)a; u64 aHigh = a >> 32;
+			u64 bLow = (u32)b; u64 bHigh = b >> 32;
+			u64 lowLow = aLow * bLow;
+			u64 lowHigh = aLow * bHigh;
+			u64 highLow = aHigh * bLow;
+			u64 middle = (lowLow >> 32) + (u32)lowHigh + (u32)highLow;
+			u64 low = (middle << 32) | (u32)lowLow;
+			u64 high = aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+			return low ^ high;
+#endif
+		}
+
+		static constexpr u64 readWord(const byte* data) {
+			if (std::is_constant_evaluated()) {
+				u64 word = 0;
+				for (int i = 0; i < 8; i++) {
+					word |= (u64)data[i] << (i * 8);
+				}
+				return word;
+			} else {
+				u64 word;
+				memcpy(&word, data, sizeof(word));
+				return word;
+			}
+		}
+
+		// The first available bytes at data, padded with zeroes.
+		static constexpr u64 readPartial(const byte* data, int available) {
+			if (available >= 8) {
+				return readWord(data);
+			} else if (available >= 4 && !std::is_constant_evaluated()) {
+				// Two overlapping reads instead of a loop.
+				u32 low; u32 high;
+				memcpy(&low, data, sizeof(low));
+				memcpy(&high, data + available - 4, sizeof(high));
+				return low | ((u64)high << ((available - 4) * 8));
+			}
+			u64 word = 0;
+			for (int i = 0; i < available; i++) {
+				word |= (u64)data[i] << (i * 8);
+			}
+			return word;
+		}
+
+		// Two independent lanes, so consecutive multiplications can overlap.
+		static constexpr void consumeStripe(u64* state, const byte* data) {
+			state[0] = mix(readWord(data) ^ SECRET[1], readWord(data + 8) ^ state[0]);
+			state[1] = mix(readWord(data + 16) ^ SECRET[2], readWord(data + 24) ^ state[1]);
+		}
+
+		// The word at offset into the rest bytes at tail, only forming a pointer to it if it has any bytes.
+		static constexpr u64 readTail(const byte* tail, int rest, int offset) {
+			return rest > offset ? readPartial(tail + offset, rest - offset) : 0;
+		}
+
+		// Mixes in the incomplete stripe at tail, its zero padding is disambiguated by also mixing in the length.
+		static constexpr u64 finish(u64 a, u64 b, u64 size, const byte* tail) {
+			int rest = (int)(size % STRIPE_SIZE);
+			if (rest > 0) {
+				a = mix(readPartial(tail, rest) ^ SECRET[1], readTail(tail, rest, 8) ^ a);
+				if (rest > 16) {
+					b = mix(readPartial(tail + 16, rest - 16) ^ SECRET[2], readTail(tail, rest, 24) ^ b);
+				}
+			}
+			return mix(mix(a ^ SECRET[0], b ^ size) ^ SECRET[3], size ^ SECRET[1]);
+		}
+
+		constexpr void feedByte(byte value) {
+			buffer[length % STRIPE_SIZE] = value;
+			length++;
+			if (length % STRIPE_SIZE == 0) {
+				consumeStripe(lanes, buffer);
+			}
+		}
+
+		void feedBytes(const byte* data, size_t size) {
+			size_t buffered = length % STRIPE_SIZE;
+			length += size;
+			if (buffered + size < STRIPE_SIZE) {
+				memcpy(buffer + buffered, data, size);
+				return;
+			}
+			if (buffered > 0) {
+				size_t missing = STRIPE_SIZE - buffered;
+				memcpy(buffer + buffered, data, missing);
+				consumeStripe(lanes, buffer);
+				data += missing;
+				size -= missing;
+			}
+			for (; size >= STRIPE_SIZE; size -= STRIPE_SIZE) {
+				consumeStripe(lanes, data);
+				data += STRIPE_SIZE;
+			}
+			memcpy(buffer, data, size);
+		}
 };
 
 }
@@ -1,34 +1,113 @@
 #ifndef PGE_RESOURCEMANAGER_H_INCLUDED
 #define PGE_RESOURCEMANAGER_H_INCLUDED
 
-#include <list>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <bit>
 
 #include "Resource.h"
 #include "RawWrapper.h"
+#include <PGE/Types/Types.h>
 
 namespace PGE {
 
+/// Owns resources and destroys them in reverse order of being added, unless they were deleted earlier.
+/// Resources live in slots that are reused once freed, views refer to them by index and generation,
+/// so a view of a deleted resource is recognized as such even if its slot has been reused.
+/// Most resources fit into their slot, and the first few slots are part of the manager itself,
+/// so a manager with a handful of resources doesn't allocate at all.
 class ResourceManager {
-    protected:
-        std::list<ResourceBase*> resources;
+    private:
+        static constexpr size_t INLINE_SIZE = 4 * sizeof(void*);
+        static constexpr u32 FIRST_CHUNK_SIZE = 4;
+        static constexpr u32 NONE = (u32)-1;
 
-        template <std::semiregular T>
-        const std::list<ResourceBase*>::iterator& getIterator(const ResourceView<T>& v) const {
-            return v.iterator;
+        struct Slot {
+            alignas(void*) byte storage[INLINE_SIZE];
+            // Null while the slot is free.
+            ResourceBase* resource = nullptr;
+            bool isInline = false;
+            // Increased every time the slot is freed.
+            u32 generation = 0;
+            // Taken slots are linked in the order they were added in, free ones only via next.
+            u32 previous = NONE;
+            u32 next = NONE;
+        };
+
+        // Slots never move, as resources are constructed in them.
+        // Chunk i holds FIRST_CHUNK_SIZE << i slots, the first one is embedded.
+        Slot firstChunk[FIRST_CHUNK_SIZE];
+        std::vector<std::unique_ptr<Slot[]>> chunks;
+        u32 slotCount = FIRST_CHUNK_SIZE;
+        // Slots past this one have never been taken.
+        u32 usedSlotCount = 0;
+        u32 firstFree = NONE;
+        u32 newest = NONE;
+
+        const Slot& getSlot(u32 index) const {
+            if (index < FIRST_CHUNK_SIZE) { return firstChunk[index]; }
+            u32 chunk = (u32)std::bit_width(index / FIRST_CHUNK_SIZE + 1) - 1;
+            return chunks[chunk - 1][index - FIRST_CHUNK_SIZE * ((1u << chunk) - 1)];
+        }
+
+        Slot& getSlot(u32 index) {
+            return const_cast<Slot&>(std::as_const(*this).getSlot(index));
         }
 
+        void destroy(Slot& slot) {
+            if (slot.isInline) {
+                std::destroy_at(slot.resource);
+            } else {
+                delete slot.resource;
+            }
+            slot.resource = nullptr;
+        }
+
+    protected:
         template <std::derived_from<ResourceBase> T, typename... Args>
         typename T::View add(Args&&... args) {
-            T* res = new T(std::forward<Args>(args)...);
-            resources.emplace_front(res);
-            return ResourceView(res->get(), resources.begin());
+            u32 index = firstFree != NONE ? firstFree : usedSlotCount;
+            if (index == slotCount) {
+                u32 chunkSize = FIRST_CHUNK_SIZE << (chunks.size() + 1);
+                chunks.emplace_back(std::make_unique<Slot[]>(chunkSize));
+                slotCount += chunkSize;
+            }
+
+            // Nothing is taken until the resource was constructed successfully.
+            Slot& slot = getSlot(index);
+            T* res;
+            if constexpr (sizeof(T) <= INLINE_SIZE && alignof(T) <= alignof(void*)) {
+                res = new (slot.storage) T(std::forward<Args>(args)...);
+                slot.isInline = true;
+            } else {
+                res = new T(std::forward<Args>(args)...);
+                slot.isInline = false;
+            }
+            slot.resource = res;
+
+            if (index == firstFree) {
+                firstFree = slot.next;
+            } else {
+                usedSlotCount++;
+            }
+            slot.previous = newest;
+            slot.next = NONE;
+            if (newest != NONE) { getSlot(newest).next = index; }
+            newest = index;
+
+            return typename T::View(res->get(), index, slot.generation);
         }
 
     public:
+        ResourceManager() = default;
+        ResourceManager(const ResourceManager&) = delete;
+        ResourceManager& operator=(const ResourceManager&) = delete;
+
         ~ResourceManager() {
-            // We do this because destruction order is not specified.
-            for (ResourceBase* res : resources) {
-                delete res;
+            // Newest first, as later resources may depend on earlier ones.
+            for (u32 index = newest; index != NONE; index = getSlot(index).previous) {
+                destroy(getSlot(index));
             }
         }
 
@@ -47,14 +126,33 @@ class ResourceManager {
             return add<RawWrapper<T>>(std::forward<Args>(args)...);
         }
 
+        /// Whether view refers to a resource of this manager that hasn't been deleted.
+        template <std::semiregular T>
+        bool isAlive(const ResourceView<T>& view) const {
+            if (!view.isHoldingResource() || view.index >= usedSlotCount) { return false; }
+            const Slot& slot = getSlot(view.index);
+            return slot.resource != nullptr && slot.generation == view.generation;
+        }
+
         template <std::semiregular T>
         void deleteResource(ResourceView<T> view) {
             if (!view.isHoldingResource()) {
                 return;
             }
+            PGE_ASSERT(isAlive(view), "Tried deleting a resource that was already deleted");
 
-            delete *view.iterator;
-            resources.erase(view.iterator);
+            Slot& slot = getSlot(view.index);
+            destroy(slot);
+            slot.generation++;
+
+            if (slot.previous != NONE) { getSlot(slot.previous).next = slot.next; }
+            if (slot.next != NONE) {
+                getSlot(slot.next).previous = slot.previous;
+            } else {
+                newest = slot.previous;
+            }
+            slot.next = firstFree;
+            firstFree = view.index;
         }
 };
 
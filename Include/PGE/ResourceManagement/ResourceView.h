@@ -1,9 +1,9 @@
 #ifndef PGE_RESOURCEVIEW_H_INCLUDED
 #define PGE_RESOURCEVIEW_H_INCLUDED
 
-#include <list>
 #include <type_traits>
 
+#include <PGE/Types/Types.h>
 #include <PGE/Exception/Exception.h>
 #include <PGE/Types/TemplateEnableIf.h>
 
@@ -16,12 +16,14 @@ class ResourceView {
 
     private:
         T internalResource;
-        std::list<ResourceBase*>::iterator iterator;
+        // The manager's slot and its generation at the time of adding, to recognize views of deleted resources.
+        u32 index = 0;
+        u32 generation = 0;
         bool holdsResource = false;
 
     public:
         ResourceView() = default;
-        ResourceView(T res, const std::list<ResourceBase*>::iterator& iter) { internalResource = res; holdsResource = true; iterator = iter; }
+        ResourceView(T res, u32 idx, u32 gen) { internalResource = res; holdsResource = true; index = idx; generation = gen; }
 
         // Force cast.
         const T& get() const { PGE_ASSERT(holdsResource, "Reference not filled"); return internalResource; }
@@ -0,0 +1,94 @@
+#ifndef PGE_INTERNEDSTRING_H_INCLUDED
+#define PGE_INTERNEDSTRING_H_INCLUDED
+
+#include "String.h"
+#include "Key.h"
+
+namespace PGE {
+
+/// A String that is stored exactly once for the lifetime of the program.
+/// Interning the same content always yields the same storage, so equality is a pointer comparison and the hash is cached.
+/// Interning is thread-safe, interned strings are never freed.
+class InternedString {
+    public:
+        /// The interned empty string.
+        InternedString();
+        /// O(n) the first time str's content is interned, lookup of its hash afterwards.
+        explicit InternedString(const String& str);
+
+        /// O(1)
+        const String& str() const { return entry->str; }
+        /// O(1)
+        u64 getHashCode() const { return entry->hash; }
+
+        /// O(1)
+        bool operator==(const InternedString& other) const { return entry == other.entry; }
+
+    private:
+        struct Entry {
+            String str;
+            u64 hash;
+        };
+        struct Table;
+
+        const Entry* entry;
+};
+
+}
+
+// Unordered containers keyed by InternedString support heterogeneous lookup with String, StringView and String::Key.
+// Lookups via String or StringView compare the content, lookups via String::Key only the hash.
+
+template<> struct std::hash<PGE::InternedString> {
+    using is_transparent = void;
+
+    size_t operator()(const PGE::InternedString& str) const {
+        return (size_t)str.getHashCode();
+    }
+
+    size_t operator()(const PGE::String& str) const {
+        return (size_t)str.getHashCode();
+    }
+
+    size_t operator()(const PGE::StringView& view) const {
+        return (size_t)view.getHashCode();
+    }
+
+    size_t operator()(const PGE::String::Key& key) const {
+        return key.hash;
+    }
+};
+
+template<> struct std::equal_to<PGE::InternedString> {
+    using is_transparent = void;
+
+    bool operator()(const PGE::InternedString& a, const PGE::InternedString& b) const {
+        return a == b;
+    }
+
+    bool operator()(const PGE::InternedString& a, const PGE::String& b) const {
+        return a.str() == b;
+    }
+
+    bool operator()(const PGE::String& a, const PGE::InternedString& b) const {
+        return a == b.str();
+    }
+
+    bool operator()(const PGE::InternedString& a, const PGE::StringView& b) const {
+        return b.equals(a.str());
+    }
+
+    bool operator()(const PGE::StringView& a, const PGE::InternedString& b) const {
+        return a.equals(b.str());
+    }
+
+    bool operator()(const PGE::InternedString& a, const PGE::String::Key& b) const {
+        return (size_t)a.getHashCode() == b.hash;
+    }
+
+    bool operator()(const PGE::String::Key& a, const PGE::InternedString& b) const {
+        return a.hash == (size_t)b.getHashCode();
+    }
+};
+
+#endif // PGE_INTERNEDSTRING_H_INCLUDED
@@ -1,13 +1,24 @@
 #ifndef PGE_STRING_KEY_H_INCLUDED
 #define PGE_STRING_KEY_H_INCLUDED
 
+#include <bit>
+#include <algorithm>
+
 #include "String.h"
+#include <PGE/Types/TemplateString.h>
+#include <PGE/Math/Hasher.h>
 
 namespace PGE {
 
 struct String::Key {
     Key() = default;
     Key(const String& str) : hash(str.getHashCode()) { }
+    /// Equal to the key of a String with the same content, without creating one.
+    Key(const StringView& view) : hash(view.getHashCode()) { }
+    // Only for direct initialization, so overloads taking a String and a Key stay unambiguous for literals.
+    template <size_t S>
+    explicit Key(const char(&cstri)[S]) : Key(StringView(cstri)) { }
+    constexpr explicit Key(u64 hash) : hash((size_t)hash) { }
     size_t hash;
 };
 
@@ -25,15 +36,45 @@ struct String::SafeKey {
     String str;
 };
 
+/// Orders like String::compare, with the first bytes of the string at hand for deciding most comparisons.
 struct String::OrderedKey {
     OrderedKey() = default;
-    OrderedKey(const String& str) : str(str) { }
-    const String str;
+    OrderedKey(const String& str) : prefix(getPrefix(str)), str(str) { }
+
+    const String& getString() const { return str; }
+
     std::weak_ordering operator<=>(const OrderedKey& other) const {
+        if (prefix != other.prefix) {
+            return prefix < other.prefix ? std::weak_ordering::less : std::weak_ordering::greater;
+        }
         return str.compare(other.str);
     }
+
+    /// The first 8 bytes of str as a big-endian integer, padded with zeroes.
+    /// Different prefixes order like the strings, equal ones don't decide anything.
+    static u64 getPrefix(const String& str) {
+        u64 prefix = 0;
+        memcpy(&prefix, str.cstr(), std::min(str.byteLength(), (int)sizeof(prefix)));
+        if constexpr (std::endian::native == std::endian::little) {
+            prefix = std::byteswap(prefix);
+        }
+        return prefix;
+    }
+
+    private:
+        // The prefix is derived from str, so neither may change on its own.
+        u64 prefix = 0;
+        String str;
 };
 
+inline namespace StringLiterals {
+    /// A key equal to that of the String with the same content, hashed at compile time.
+    template <TemplateString STR>
+    consteval String::Key operator""_key() {
+        return String::Key(Hasher::getHash(std::span(STR.cstr, sizeof(STR.cstr) - 1)));
+    }
+}
+
 }
 
 template<> struct std::hash<PGE::String::Key> {
@@ -0,0 +1,67 @@
+#ifndef PGE_REGEX_H_INCLUDED
+#define PGE_REGEX_H_INCLUDED
+
+#include <memory>
+#include <vector>
+#include <optional>
+
+#include "String.h"
+#include "StringView.h"
+
+namespace PGE {
+
+/// A regular expression that is compiled once and matched directly on UTF-8.
+/// Finding one match takes time linear to the length of the text.
+/// Supports the ECMAScript syntax except for backreferences, lookarounds and word boundaries:
+/// Literals, ., classes with ranges and negation, \\d \\w \\s and their negations, escapes like \\n, \\xHH and \\uXXXX,
+/// ^ and $ at the start and end of the text, groups, alternation and greedy or lazy *, +, ?, {n}, {n,} and {n,m}.
+/// Matches are the same a backtracking ECMAScript matcher finds:
+/// The leftmost one, preferring earlier alternatives and greedy repetitions that go on for longer.
+/// The only exception are repeated groups that can match nothing, whose empty repetitions aren't rejected.
+///
+/// Matching caches its automaton in the Regex, so one Regex must not be used by multiple threads at once.
+/// Copies share the compiled pattern, but not the cache, and can be used independently.
+class Regex {
+    public:
+        /// Throws an Exception if the pattern is malformed or uses unsupported syntax.
+        explicit Regex(const StringView& pattern);
+        Regex(const Regex& other);
+        Regex(Regex&& other) noexcept;
+        Regex& operator=(const Regex& other);
+        Regex& operator=(Regex&& other) noexcept;
+        ~Regex();
+
+        /// @returns A view of the first match in str, or nothing if there is none.
+        std::optional<StringView> find(const StringView& str) const;
+        /// Whether the whole of str matches.
+        bool matches(const StringView& str) const;
+        /// All non-overlapping matches, in order.
+        /// After an empty match, the search continues one character later.
+        /// Each match is searched for separately, so this takes up to O(length * matches) time:
+        /// A preferred alternative can keep going until the end of the text before a shorter match is settled on,
+        /// like a+b|a does on a text of only a's.
+        std::vector<StringView> findAll(const StringView& str) const;
+        /// Replaces all matches #findAll finds with replacement, which is inserted as-is.
+        /// Takes as long as #findAll.
+        String replace(const StringView& str, const StringView& replacement) const;
+
+    private:
+        struct Node;
+        struct Parser;
+        struct Program;
+        struct Dfa;
+
+        // The reverse program matches the reversed pattern from the end of a match to find its start.
+        std::shared_ptr<const Program> forward;
+        std::shared_ptr<const Program> reverse;
+        // Built lazily as states are needed.
+        mutable std::unique_ptr<Dfa> forwardDfa;
+        mutable std::unique_ptr<Dfa> reverseDfa;
+
+        /// @returns The byte range of the first match starting at or after byte from, false if there is none.
+        bool search(const StringView& str, int from, int& start, int& end) const;
+};
+
+}
+
+#endif // PGE_REGEX_H_INCLUDED
@@ -5,8 +5,11 @@
 #include <functional>
 #include <vector>
 #include <string>
-#include <regex>
-#include <variant>
+#include <atomic>
+#include <memory>
+#include <array>
+#include <cstring>
+#include <span>
 
 #if defined(__APPLE__) && defined(__OBJC__)
 #import <Foundation/NSString.h>
@@ -15,6 +18,9 @@
 #include <PGE/Types/Types.h>
 #include <PGE/Types/Range.h>
 #include <PGE/Types/FlagEnum.h>
+#include <PGE/Types/TemplateString.h>
+#include <PGE/Math/Hasher.h>
+#include <PGE/String/StringView.h>
 
 namespace PGE {
 
@@ -24,16 +30,30 @@ template <typename T, byte BASE>
 concept ValidBaseForType = BASE == 10 && std::integral<T> || std::unsigned_integral<T> && (BASE >= 2 && BASE < 36);
 
 class String;
+class InternedString;
+class StringBuilder;
 
 inline namespace StringLiterals {
-    String operator""_PGE(const char* cstr, size_t size);
+    /// All metadata is computed at compile time.
+    template <TemplateString STR>
+    String operator""_PGE();
     String operator""_PGE(const char8_t* cstr, size_t size);
     String operator""_PGE(const char16* wstr, size_t size);
 }
 
 /// A UTF-8 character sequence guaranteed to be terminated by a null byte.
+///
+/// Const member functions may be called from multiple threads at once, on the same String or on copies sharing a buffer.
+/// Metadata they compute lazily (length, hash code, random access index) is published atomically.
+/// Modifying a String still requires exclusive access to that object, copies are unaffected by it.
 class String {
+    friend StringBuilder;
+    friend StringView;
+
     private:
+        // Every this many codepoints, the byte position is remembered for random access.
+        static constexpr int CODEPOINT_INDEX_STRIDE = 32;
+
         class BasicIterator {
             public:
                 using iterator_category = std::bidirectional_iterator_tag;
@@ -67,6 +87,7 @@ class String {
         template <bool REVERSE>
         class ActualIterator : public BasicIterator {
             friend ActualIterator<!REVERSE>;
+            friend String;
 
             private:
                 ActualIterator(const String& str, int byteIndex, int chIndex) {
@@ -76,6 +97,8 @@ class String {
                 }
                 
                 void validate();
+                // Moves by the given amount of characters in one go, negative amounts move backwards.
+                void jump(int steps);
 
             public:
                 ActualIterator() = default;
@@ -100,13 +123,15 @@ class String {
                 ActualIterator operator+(int steps) const { ActualIterator ret(*this); ret += steps; return ret; }
                 ActualIterator operator-(int steps) const { ActualIterator ret(*this); ret -= steps; return ret; }
                 void operator+=(int steps) {
-                    if (steps < 0) { *this -= -steps; }
+                    if (steps < 0) { *this -= -steps; return; }
+                    if (steps >= CODEPOINT_INDEX_STRIDE && index >= 0) { jump(steps); return; }
                     for (PGE_IT : Range(steps)) {
                         ++(*this);
                     }
                 }
                 void operator-=(int steps) {
-                    if (steps < 0) { *this += -steps; }
+                    if (steps < 0) { *this += -steps; return; }
+                    if (steps >= CODEPOINT_INDEX_STRIDE && index >= 0) { jump(-steps); return; }
                     for (PGE_IT : Range(steps)) {
                         --(*this);
                     }
@@ -151,9 +176,9 @@ class String {
         >::type>
         String(T cstri) {
             int len = (int)strlen(cstri);
-            const auto& [cstrBuf, data] = reallocate(len);
-            data->strByteLength = len;
-            memcpy(cstrBuf, cstri, len + 1);
+            char* buf = reallocate(len);
+            memcpy(buf, cstri, len + 1);
+            setLengths(len);
         }
 
         String(const char8_t* cstr);
@@ -168,8 +193,16 @@ class String {
         String(char16 w);
 
         String(const String& a, const String& b);
+        explicit String(const StringView& view);
 
-        friend String StringLiterals::operator""_PGE(const char* cstr, size_t size);
+        String(const String& other);
+        String(String&& other) noexcept;
+        String& operator=(const String& other);
+        String& operator=(String&& other) noexcept;
+        ~String();
+
+        template <TemplateString STR>
+        friend String StringLiterals::operator""_PGE();
         friend String StringLiterals::operator""_PGE(const char8_t* cstr, size_t size);
         friend String StringLiterals::operator""_PGE(const char16* wstr, size_t size);
 
@@ -186,6 +219,17 @@ class String {
             LOWER,
         };
 
+        /// Replaces every "{}" in FMT with the next argument, "{{" and "}}" stand for single braces.
+        /// Strings, characters, booleans and numbers are inserted as-is, everything else goes through #from.
+        /// FMT is checked against the arguments at compile time.
+        /// 
+        /// The arguments are measured before anything is written, so the result is allocated only once.
+        template <TemplateString FMT, typename... Args>
+        static String format(const Args&... args);
+        /// Appends what #format would return to builder. Defined in StringBuilder.h.
+        template <TemplateString FMT, typename... Args>
+        static void formatTo(StringBuilder& builder, const Args&... args);
+
         template <std::unsigned_integral I> static String binFromInt(I i);
         template <std::unsigned_integral I> static String octFromInt(I i);
         template <std::unsigned_integral I> static String hexFromInt(I i, Casing casing = Casing::UPPER);
@@ -197,7 +241,7 @@ class String {
         /// Guaranteed to have a null byte appended to the string's content.
         /// 
         /// O(1)
-        const char* cstr() const;
+        const char* cstr() const { return cstrBuf; }
         const char8_t* c8str() const;
         std::vector<char16> wstr() const;
 
@@ -263,33 +307,78 @@ class String {
         String replace(const String& fnd, const String& rplace) const;
         String toUpper() const;
         String toLower() const;
+        /// Full case folding, two strings are equal ignoring case exactly when their foldings are equal.
+        String foldCase() const;
         String trim() const;
         String reverse() const;
         String repeat(int count, const String& separator = "") const;
         std::vector<String> split(const String& needleStr, bool removeEmptyEntries) const;
-        static String join(const Enumerable<String> auto& vect, const String& separator) {
-            if (std::ranges::empty(vect)) {
-                return String();
-            }
 
-            auto it = std::ranges::begin(vect);
+        /// Variants that refer to the string's data instead of copying it.
+        /// The views are invalidated by modifying, moving or destroying the string.
+        StringView substrView(int start) const;
+        StringView substrView(int start, int cnt) const;
+        StringView trimView() const;
+        std::vector<StringView> splitView(const StringView& needle, bool removeEmptyEntries) const;
+
+        /// Concatenates all pieces with a single allocation.
+        /// Pieces can be anything a StringView can be constructed from, like Strings and literals.
+        template <typename... Args> requires (sizeof...(Args) > 0)
+        static String concat(const Args&... pieces) {
+            const StringView views[] = { StringView(pieces)... };
+            return concatViews(views);
+        }
 
-            String retVal = *it;
-            it++;
-            for (; it != std::ranges::end(vect); it++) {
-                retVal += separator + *it;
+        /// Sums up the lengths first, so that joining takes a single allocation.
+        /// vect is iterated twice, which is why single-pass ranges aren't accepted.
+        template <std::ranges::forward_range R> requires Enumerable<R, String>
+        static String join(const R& vect, const String& separator) {
+            int count = 0;
+            int byteLength = 0;
+            int length = 0;
+            for (const String& str : vect) {
+                count++;
+                byteLength += str.byteLength();
+                length = length < 0 || str.knownLength() < 0 ? -1 : length + str.knownLength();
             }
-
-            return retVal;
+            if (count == 0) {
+                return String();
+            }
+            byteLength += (count - 1) * separator.byteLength();
+            length = length < 0 || separator.knownLength() < 0 ? -1 : length + (count - 1) * separator.knownLength();
+
+            String ret;
+            char* buf = ret.reallocate(byteLength);
+            bool first = true;
+            for (const String& str : vect) {
+                if (!first) {
+                    memcpy(buf, separator.cstr(), separator.byteLength());
+                    buf += separator.byteLength();
+                }
+                first = false;
+                memcpy(buf, str.cstr(), str.byteLength());
+                buf += str.byteLength();
+            }
+            ret.setLengths(byteLength, length);
+            return ret;
         }
 
+        /// The first match of pattern, empty if there is none.
+        /// Recently used patterns are kept compiled per thread, see Regex for the supported syntax.
         String regexMatch(const String& pattern) const;
 
+        /// Looks up or adds the string's content in the global interning table.
+        /// See InternedString.
+        InternedString intern() const;
+
         //String unHex() const;
 
         u64 getHashCode() const;
 
+        /// Orders by codepoints, which is the same as comparing the UTF-8 bytes.
         std::weak_ordering compare(const String& other) const;
+        /// Sorts by #compare on all hardware threads.
+        static void sort(std::vector<String>& strs);
 
         bool equals(const String& other) const;
         bool equalsIgnoreCase(const String& other) const;
@@ -297,74 +386,261 @@ class String {
 
     private:
         struct Metadata;
-        String(int sz, char*& charBuffer, Metadata*& data);
+        String(int sz, char*& charBuffer);
         String(const char* cstr, size_t size);
-        String(const String& other, int from, int cnt);
+        String(const char* cstr, const Metadata& data);
+
+        // A value computed on demand by const methods, possibly on multiple threads at once.
+        // Every thread computes the same value, so relaxed atomics are enough to make the writes race-free.
+        template <typename T>
+        class Lazy {
+            public:
+                Lazy(T val) : value(val) { }
+                Lazy(const Lazy& other) : value(other.load()) { }
+                Lazy& operator=(const Lazy& other) { store(other.load()); return *this; }
+
+                T load() const { return value.load(std::memory_order_relaxed); }
+                void store(T val) const { value.store(val, std::memory_order_relaxed); }
 
-        static constexpr int SHORT_STR_CAPACITY = 40;
+            private:
+                mutable std::atomic<T> value;
+        };
 
         struct Metadata {
-            // Lazily evaluated.
-            mutable u64 _hashCode = 0;
-            mutable int _strLength = -1;
+            Lazy<u64> _hashCode = 0;
+            Lazy<int> _strLength = -1;
 
             int strByteLength = -1;
         };
 
-        struct CoreInfo {
-            char* cstrBuf;
-            Metadata* data;
-        };
+        // Prefix of the heap allocation of long strings, shared by all copies and followed by the characters.
+        struct Header {
+            explicit Header(int cap) : refCount(1), capacity(cap) { }
+            ~Header() { delete codepointIndex.load(std::memory_order_relaxed); }
 
-        struct HeapAllocData {
+            std::atomic<int> refCount;
+            // Including the terminating null byte.
+            int capacity;
             Metadata data;
-            int cCapacity;
-            std::unique_ptr<char[]> cstrBuf;
-            CoreInfo get() {
-                return { cstrBuf.get(), &data };
-            }
+            // Lazily evaluated on the first random access, never for strings where every byte is a codepoint.
+            // Element i is the byte position of codepoint (i + 1) * CODEPOINT_INDEX_STRIDE.
+            // Owned, published with release semantics so that readers on other threads see it completely built.
+            std::atomic<const std::vector<int>*> codepointIndex = nullptr;
+            // Hashing progress over the start of the characters, which appending leaves untouched.
+            // Only written when the string is changed, readers hash into a copy of it.
+            Hasher::Prefix hashPrefix;
+
+            char* chars() { return (char*)(this + 1); }
+
+            /// Room for at least minCapacity bytes, rounded up so the whole allocation is a power of two.
+            static Header* allocate(int minCapacity);
+            /// Frees the allocation once the last reference is released.
+            void release();
         };
 
-        struct StackAllocData {
-            Metadata data;
-            char cstrBuf[SHORT_STR_CAPACITY];
-            CoreInfo get() {
-                return { cstrBuf, &data };
-            }
+        struct HeaderDeleter {
+            void operator()(Header* header) const { header->release(); }
         };
 
-        struct LiteralData {
-            std::variant<Metadata, Metadata*> data;
-            char* cstrBuf;
-            Metadata* shareData();
-            Metadata* getData() {
-                if (std::holds_alternative<Metadata>(data)) {
-                    return &std::get<Metadata>(data);
-                } else {
-                    return std::get<Metadata*>(data);
-                }
-            }
-            const CoreInfo get() {
-                return { cstrBuf, getData() };
-            }
+        // Including the terminating null byte.
+        static constexpr int SHORT_STR_CAPACITY = 23;
+
+        // Lengths of short strings are cheap to compute, so none are stored beyond the byte length.
+        struct ShortData {
+            char chars[SHORT_STR_CAPACITY];
+            u8 byteLength;
         };
 
-        // Default initialized with Unique.
-        mutable std::variant<StackAllocData, std::shared_ptr<HeapAllocData>, LiteralData> internalData;
+        // Heap allocated if there is a header, a literal that's pointed to otherwise.
+        struct LongData {
+            Header* header;
+            // Only used by literals, the metadata of heap allocated strings lives in their header.
+            Metadata data;
+        };
+
+        // Always points at the characters, into shortData for short strings.
+        // This makes reading them free of branches, at the cost of fixing the pointer up on copies.
+        char* cstrBuf = shortData.chars;
+        union {
+            ShortData shortData = { };
+            LongData longData;
+        };
 
-        char* getChars() const;
+        bool isShort() const { return cstrBuf == shortData.chars; }
+        // Only for long strings.
         Metadata* getData() const;
+        // Negative if it would have to be counted, short strings are always counted.
+        int knownLength() const;
+        /// hashPrefix has to cover bytes that stayed the same, i.e. when appending.
+        void setLengths(int newByteLength, int newLength = -1, const Hasher::Prefix& hashPrefix = { });
+        /// Progress to keep when appending, caught up with the current content if its hash was computed.
+        Hasher::Prefix getHashPrefix() const;
 
-        String performCaseConversion(const std::function<void(String&, char16)>& func) const;
+        void copyFrom(const String& other);
+        void moveFrom(String& other);
+        void release();
+
+        /// O(1) amortized, pos may be equal to #length().
+        int getBytePosition(int pos) const;
+
+        /// ASCII letters starting at asciiFrom have their case flipped, everything else goes through func.
+        String performCaseConversion(char asciiFrom, void (*func)(StringBuilder&, char16)) const;
 
         void wCharToUtf8Str(const char16* wbuffer);
-        CoreInfo reallocate(int size, bool copyOldChs = false);
+        /// Makes the buffer unique and able to hold size bytes and the terminating null byte.
+        /// The content has to be finished off via #setLengths.
+        char* reallocate(int size, bool copyOldChs = false);
+
+        static String concatViews(std::span<const StringView> views);
 
         template <std::integral I, byte BASE = 10> requires ValidBaseForType<I, BASE>
         static String fromInteger(I i, Casing casing = Casing::UPPER);
         template <std::floating_point F>
         static String fromFloatingPoint(F f);
+
+        // A format string split at its placeholders, with escaped braces already replaced.
+        template <size_t N>
+        struct ParsedFormat {
+            char chars[N] { };
+            int byteLength = 0;
+            int length = 0;
+            // Literal segment i ends at segmentEnds[i], there is one more segment than there are placeholders.
+            int segmentEnds[N] { };
+            int placeholderCount = 0;
+            bool valid = true;
+        };
+
+        template <TemplateString FMT, size_t ARG_COUNT>
+        static consteval ParsedFormat<sizeof(FMT.cstr)> parseFormat() {
+            constexpr ParsedFormat<sizeof(FMT.cstr)> PARSED = [] {
+                ParsedFormat<sizeof(FMT.cstr)> parsed;
+                for (size_t i = 0; i + 1 < sizeof(FMT.cstr); i++) {
+                    char ch = FMT.cstr[i];
+                    if (ch == '{' && FMT.cstr[i + 1] == '}') {
+                        parsed.segmentEnds[parsed.placeholderCount++] = parsed.byteLength;
+                        i++;
+                        continue;
+                    }
+                    if (ch == '{' || ch == '}') {
+                        if (FMT.cstr[i + 1] != ch) { parsed.valid = false; }
+                        i++;
+                    }
+                    parsed.chars[parsed.byteLength++] = ch;
+                    // Every byte that isn't a continuation byte starts a codepoint.
+                    parsed.length += (ch & 0b1100'0000) != 0b1000'0000;
+                }
+                parsed.segmentEnds[parsed.placeholderCount] = parsed.byteLength;
+                return parsed;
+            }();
+            static_assert(PARSED.valid, "Braces in format strings have to be escaped by doubling them");
+            static_assert(PARSED.placeholderCount == ARG_COUNT, "Format strings need exactly one {} per argument");
+            return PARSED;
+        }
+
+        // An argument of #format, converted to text.
+        class FormatArg;
+
+        template <size_t N, size_t ARG_COUNT>
+        static void writeFormatted(char* buf, const ParsedFormat<N>& format, const std::array<FormatArg, ARG_COUNT>& args);
 };
+
+// An argument of String::format, converted to text.
+class String::FormatArg {
+    public:
+        template <typename T>
+        FormatArg(const T& t);
+        FormatArg(const FormatArg&) = delete;
+
+        const StringView& getText() const { return text; }
+
+    private:
+        // Room for any number.
+        char digits[64];
+        String converted;
+        StringView text;
+
+        void setChar(char16 ch);
+        void setInteger(long long i);
+        void setInteger(unsigned long long i);
+        void setFloat(float f);
+        void setFloat(double f);
+        void setFloat(long double f);
+};
+
+template <typename T>
+String::FormatArg::FormatArg(const T& t) {
+    if constexpr (std::derived_from<T, String> || std::same_as<T, StringView>) {
+        text = StringView(t);
+    } else if constexpr (std::convertible_to<const T&, const char*>) {
+        const char* cstr = t;
+        text = StringView(cstr, (int)strlen(cstr));
+    } else if constexpr (std::same_as<T, bool>) {
+        text = t ? StringView("true") : StringView("false");
+    } else if constexpr (std::same_as<T, char>) {
+        text = StringView(&t, 1);
+    } else if constexpr (std::same_as<T, char16>) {
+        setChar(t);
+    } else if constexpr (std::signed_integral<T>) {
+        setInteger((long long)t);
+    } else if constexpr (std::unsigned_integral<T>) {
+        setInteger((unsigned long long)t);
+    } else if constexpr (std::floating_point<T>) {
+        setFloat(t);
+    } else {
+        converted = String::from(t);
+        text = StringView(converted);
+    }
+}
+
+template <size_t N, size_t ARG_COUNT>
+void String::writeFormatted(char* buf, const ParsedFormat<N>& format, const std::array<FormatArg, ARG_COUNT>& args) {
+    int segmentStart = 0;
+    for (size_t i = 0; i < ARG_COUNT; i++) {
+        memcpy(buf, format.chars + segmentStart, format.segmentEnds[i] - segmentStart);
+        buf += format.segmentEnds[i] - segmentStart;
+        memcpy(buf, args[i].getText().data(), args[i].getText().byteLength());
+        buf += args[i].getText().byteLength();
+        segmentStart = format.segmentEnds[i];
+    }
+    memcpy(buf, format.chars + segmentStart, format.byteLength - segmentStart);
+}
+
+template <TemplateString FMT, typename... Args>
+String String::format(const Args&... args) {
+    static constexpr ParsedFormat<sizeof(FMT.cstr)> FORMAT = parseFormat<FMT, sizeof...(Args)>();
+    const std::array<FormatArg, sizeof...(Args)> formatted { args... };
+    int byteLength = FORMAT.byteLength;
+    for (const FormatArg& arg : formatted) {
+        byteLength += arg.getText().byteLength();
+    }
+    char* buf;
+    String ret(byteLength, buf);
+    writeFormatted(buf, FORMAT, formatted);
+    ret.setLengths(byteLength);
+    return ret;
+}
+
+template <size_t N>
+TemplateString<N>::operator String() const {
+    return String(cstr);
+}
+
+template <TemplateString STR>
+String StringLiterals::operator""_PGE() {
+    constexpr int BYTE_LENGTH = (int)sizeof(STR.cstr) - 1;
+    constexpr int LENGTH = [] {
+        int length = 0;
+        for (int i = 0; i < BYTE_LENGTH; i++) {
+            // Every byte that isn't a continuation byte starts a codepoint.
+            length += (STR.cstr[i] & 0b1100'0000) != 0b1000'0000;
+        }
+        return length;
+    }();
+    constexpr u64 HASH = Hasher::getHash(std::span(STR.cstr, BYTE_LENGTH));
+    // The template parameter object has static storage duration, so pointing into it is fine.
+    return String(STR.cstr, String::Metadata { ._hashCode = HASH, ._strLength = LENGTH, .strByteLength = BYTE_LENGTH });
+}
+
 String operator+(const String& a, const String& b);
 String operator+(String&& a, const String& b);
 bool operator==(const String& a, const String& b);
@@ -0,0 +1,86 @@
+#ifndef PGE_STRINGBUILDER_H_INCLUDED
+#define PGE_STRINGBUILDER_H_INCLUDED
+
+#include <span>
+#include <memory>
+
+#include "String.h"
+
+namespace PGE {
+
+/// Accumulates UTF-8 in a buffer that grows geometrically, for constructing strings piece by piece.
+/// The buffer is handed over to the String returned by #build without copying it.
+class StringBuilder {
+    friend String;
+
+    public:
+        StringBuilder() = default;
+        /// @param[in] byteCapacity Bytes to reserve up front, excluding the terminating null byte.
+        explicit StringBuilder(int byteCapacity);
+        /// Continues building on str, taking over its buffer if it is not shared with any other string.
+        explicit StringBuilder(String&& str);
+
+        /// Makes sure that byteCapacity bytes fit without reallocating, excluding the terminating null byte.
+        void reserve(int byteCapacity);
+
+        void append(const String& str);
+        void append(char16 ch);
+        /// Appends the UTF-16 units, each one as its own codepoint.
+        /// Nothing is appended if any of them is not a valid character.
+        void appendUtf16(std::span<const char16> units);
+        /// Appends the bytes as-is, they are expected to form well-formed UTF-8 once building is done.
+        void appendBytes(std::span<const char> bytes);
+        /// Appends the bytes as-is, without counting the codepointCount codepoints they are known to form.
+        void appendBytes(std::span<const char> bytes, int codepointCount);
+        void appendByte(char ch);
+
+        void operator+=(const String& str) { append(str); }
+        void operator+=(char16 ch) { append(ch); }
+
+        /// The bytes appended so far, NOT terminated by a null byte.
+        const char* data() const;
+        int byteLength() const;
+        int length() const;
+        bool isEmpty() const;
+
+        /// Discards the content, but keeps the buffer.
+        void clear();
+
+        /// Moves the content into a String and leaves the builder empty.
+        ///
+        /// O(1), short strings are copied into the String's inline buffer.
+        String build();
+
+    private:
+        static constexpr int MIN_CAPACITY = 32;
+
+        // Laid out like the allocation of a long String, so it can be handed over as-is.
+        std::unique_ptr<String::Header, String::HeaderDeleter> buffer;
+        int strByteLength = 0;
+        // Tracked additively, every byte that isn't a continuation byte starts a codepoint.
+        int strLength = 0;
+
+        // Including the terminating null byte.
+        int getCapacity() const;
+        void makeSpace(int additionalBytes);
+        /// Appends byteCount bytes forming codepointCount codepoints, which have to be written to the returned buffer.
+        char* appendUninitialized(int byteCount, int codepointCount);
+        void resize(int newCapacity);
+};
+
+template <TemplateString FMT, typename... Args>
+void String::formatTo(StringBuilder& builder, const Args&... args) {
+    static constexpr ParsedFormat<sizeof(FMT.cstr)> FORMAT = parseFormat<FMT, sizeof...(Args)>();
+    const std::array<FormatArg, sizeof...(Args)> formatted { args... };
+    int byteLength = FORMAT.byteLength;
+    int length = FORMAT.length;
+    for (const FormatArg& arg : formatted) {
+        byteLength += arg.getText().byteLength();
+        length += arg.getText().length();
+    }
+    writeFormatted(builder.appendUninitialized(byteLength, length), FORMAT, formatted);
+}
+
+}
+
+#endif // PGE_STRINGBUILDER_H_INCLUDED
@@ -0,0 +1,124 @@
+#ifndef PGE_STRINGVIEW_H_INCLUDED
+#define PGE_STRINGVIEW_H_INCLUDED
+
+#include <vector>
+#include <compare>
+#include <iterator>
+#include <ranges>
+#include <functional>
+
+#include <PGE/Types/Types.h>
+
+namespace PGE {
+
+class String;
+
+/// A non-owning view of a UTF-8 character sequence, usually a part of a String.
+/// The viewed bytes have to outlive the view and are NOT necessarily terminated by a null byte.
+/// Taking parts of a view never allocates.
+class StringView {
+    public:
+        class Iterator {
+            public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using difference_type = int;
+                using value_type = char16;
+                using pointer = value_type*;
+                using reference = value_type&;
+
+                Iterator() = default;
+
+                char16 operator*() const;
+
+                Iterator& operator++();
+                Iterator& operator--();
+                Iterator operator++(int) { Iterator temp = *this; ++*this; return temp; }
+                Iterator operator--(int) { Iterator temp = *this; --*this; return temp; }
+
+                Iterator operator+(int steps) const { Iterator ret(*this); ret += steps; return ret; }
+                Iterator operator-(int steps) const { Iterator ret(*this); ret -= steps; return ret; }
+                void operator+=(int steps);
+                void operator-=(int steps);
+
+                int operator-(const Iterator& other) const;
+                bool operator==(const Iterator& other) const;
+
+                int getBytePosition() const;
+                int getPosition() const;
+
+            private:
+                friend StringView;
+                Iterator(const StringView& view, int byteIndex, int chIndex);
+
+                const char* buf = nullptr;
+                int bufLength = 0;
+                int index = 0;
+                // Lazily evaluated, negative if unknown.
+                mutable int charIndex = 0;
+                mutable char16 _ch = L'\uFFFF';
+        };
+
+        StringView() = default;
+        StringView(const String& str);
+        StringView(const char* bytes, int byteCount);
+
+        template <size_t S>
+        StringView(const char(&cstri)[S])
+            : StringView(cstri, (int)S - 1) { }
+
+        Iterator begin() const;
+        Iterator end() const;
+
+        /// The viewed bytes, not necessarily terminated by a null byte.
+        const char* data() const { return buf; }
+        /// O(1)
+        int byteLength() const { return bufLength; }
+        /// First call on the same view: O(n), successive calls: O(1)
+        int length() const;
+        bool isEmpty() const { return bufLength == 0; }
+
+        bool contains(const StringView& fnd) const;
+        Iterator findFirst(const StringView& fnd, int from = 0) const;
+        Iterator findFirst(const StringView& fnd, const Iterator& from) const;
+        /// @returns An iterator to the start of the last occurrence, #end if there is none.
+        Iterator findLast(const StringView& fnd) const;
+
+        StringView substr(int start) const;
+        StringView substr(int start, int cnt) const;
+        StringView substr(const Iterator& start) const;
+        StringView substr(const Iterator& start, const Iterator& to) const;
+        StringView trim() const;
+        std::vector<StringView> split(const StringView& needle, bool removeEmptyEntries) const;
+
+        /// Equal to the hash code of a String with the same content.
+        u64 getHashCode() const;
+
+        std::weak_ordering compare(const StringView& other) const;
+        bool equals(const StringView& other) const;
+
+        /// Copies the viewed content into a String.
+        String str() const;
+
+    private:
+        friend String;
+
+        const char* buf = "";
+        int bufLength = 0;
+        // Lazily evaluated.
+        mutable int _strLength = 0;
+};
+
+bool operator==(const StringView& a, const StringView& b);
+
+static_assert(std::bidirectional_iterator<StringView::Iterator>);
+static_assert(std::ranges::bidirectional_range<StringView>);
+
+}
+
+template<> struct std::hash<PGE::StringView> {
+    size_t operator()(const PGE::StringView& view) const {
+        return (size_t)view.getHashCode();
+    }
+};
+
+#endif // PGE_STRINGVIEW_H_INCLUDED
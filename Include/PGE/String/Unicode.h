@@ -1,6 +1,8 @@
 #ifndef PGE_UNICODE_H_INCLUDED
 #define PGE_UNICODE_H_INCLUDED
 
+#include <span>
+
 #include <PGE/Types/Types.h>
 
 namespace PGE {
@@ -9,6 +11,22 @@ namespace Unicode {
 	// S and Cc.
 	bool isSpace(char16 ch);
 	bool isDigit(char16 ch);
+
+	/// FNV-1a hash of the properties and the folded, upper and lower case of every char16,
+	/// computed by the generator of the tables from the Unicode data, so tests can check the tables against it.
+	extern const u64 TABLE_DIGEST;
+
+	// Bulk conversions between UTF-8 and UTF-16, working on whole blocks of ASCII, 2-byte and 3-byte sequences at once.
+	// Like everywhere else, every UTF-16 unit is its own codepoint, surrogate pairs are not combined.
+
+	/// The number of bytes #utf16ToUtf8 writes for utf16.
+	int measureUtf8(std::span<const char16> utf16);
+	/// utf8 has to hold at least #measureUtf8 bytes.
+	/// @returns The number of bytes written.
+	int utf16ToUtf8(std::span<const char16> utf16, std::span<char> utf8);
+	/// utf8 has to be well-formed, utf16 has to hold one unit per codepoint.
+	/// @returns The number of units written.
+	int utf8ToUtf16(std::span<const char> utf8, std::span<char16> utf16);
 }
 
 }
@@ -4,13 +4,13 @@
 #include <PGE/Types/Types.h>
 #include <PGE/String/String.h>
 #include <PGE/String/Key.h>
+#include <PGE/String/InternedString.h>
 #include <PGE/Math/Vector.h>
 #include <PGE/Math/Matrix.h>
 #include <PGE/Color/Color.h>
 #include <PGE/Types/PolymorphicHeap.h>
 #include <PGE/Types/Concepts.h>
-
-#include <unordered_map>
+#include <PGE/Types/FlatHashMap.h>
 
 namespace PGE {
 
@@ -41,20 +41,30 @@ class StructuredData {
                 ElemLayout(const Enumerable<Entry> auto& entrs) {
                     int currLocation = 0;
                     for (const auto& entry : entrs) {
-                        entries.emplace(entry.name, LocationAndSize(currLocation, entry.size));
+                        entries.emplace(entry.name.intern(), LocationAndSize(currLocation, entry.size));
                         currLocation += entry.size;
                     }
                     elementSize = currLocation;
                 }
 
-                const LocationAndSize& getLocationAndSize(const String& name) const;
-                const LocationAndSize& getLocationAndSize(const String::Key& name) const;
+                const LocationAndSize& getLocationAndSize(const String& name) const { return getEntry(name).second; }
+                const LocationAndSize& getLocationAndSize(const InternedString& name) const { return getEntry(name).second; }
+                /// Only compares hashes, use the other overloads when collisions are a concern.
+                const LocationAndSize& getLocationAndSize(const String::Key& name) const { return getEntry(name).second; }
                 int getElementSize() const;
 
                 bool operator==(const StructuredData::ElemLayout& other) const = default;
             private:
+                friend StructuredData;
+                using Entries = FlatHashMap<InternedString, LocationAndSize>;
+
                 int elementSize;
-                std::unordered_map<String::Key, LocationAndSize> entries;
+                Entries entries;
+
+                // The entry's name comes along with its location, for error messages.
+                const Entries::Entry& getEntry(const String& name) const;
+                const Entries::Entry& getEntry(const InternedString& name) const;
+                const Entries::Entry& getEntry(const String::Key& key) const;
         };
 
         StructuredData() = default;
@@ -74,15 +84,23 @@ class StructuredData {
         const ElemLayout& getLayout() const;
 
         void setValue(int elemIndex, const String& entry, const StructuredType auto& value) {
-            setValue(elemIndex, String::Key(entry), value);
+            setValueAt(elemIndex, layout.getEntry(entry), value);
+        }
+
+        void setValue(int elemIndex, const InternedString& entry, const StructuredType auto& value) {
+            setValueAt(elemIndex, layout.getEntry(entry), value);
         }
 
         void setValue(int elemIndex, const String::Key& entry, const StructuredType auto& value) {
-            memcpy(data.get() + getDataIndex(elemIndex, entry, sizeof(value)), &value, sizeof(value));
+            setValueAt(elemIndex, layout.getEntry(entry), value);
         }
 
     private:
-        int getDataIndex(int elemIndex, const String::Key& entry, int expectedSize) const;
+        void setValueAt(int elemIndex, const ElemLayout::Entries::Entry& entry, const StructuredType auto& value) {
+            memcpy(data.get() + getDataIndex(elemIndex, entry, sizeof(value)), &value, sizeof(value));
+        }
+
+        int getDataIndex(int elemIndex, const ElemLayout::Entries::Entry& entry, int expectedSize) const;
 
         ElemLayout layout; //don't change this to a pointer, stop preemptively optimizing!!!!!
         std::unique_ptr<byte[]> data;
@@ -2,16 +2,24 @@
 #define PGE_CIRCULARARRAY_H_INCLUDED
 
 #include <ranges>
+#include <algorithm>
+#include <array>
+#include <span>
+#include <bit>
+#include <memory>
 
 #include <PGE/Types/Range.h>
 #include <PGE/Exception/Exception.h>
 
 namespace PGE {
 
+/// A double-ended queue in a single ring buffer.
+/// The capacity is always a power of two, so wrapping an index around is a bitmask instead of a division.
 template <typename T, typename Allocator = std::allocator<T>>
 class CircularArray {
     private:
         static constexpr int GROWTH_FACTOR = 4;
+        static_assert(std::has_single_bit((unsigned)GROWTH_FACTOR), "Growing has to keep the capacity a power of two");
 
         Allocator alloc;
         T* elements = nullptr;
@@ -19,39 +27,59 @@ class CircularArray {
         size_t beginIndex = 0;
         size_t endIndex = 0;
 
+        // beginIndex is always less than the capacity, endIndex may exceed it by up to the capacity.
+        constexpr size_t wrap(size_t index) const {
+            return index & (capacity - 1);
+        }
+
         constexpr void deleteElems() {
             if constexpr (std::is_trivially_destructible<T>::value) {
                 return;
             }
             
             for (size_t i : Range(beginIndex, endIndex)) {
-                elements[i % capacity].~T();
+                elements[wrap(i)].~T();
             }
         }
 
+        // Constructs the elements in order at the uninitialized loc.
+        template <bool MOVE>
         constexpr void copyContents(T* loc) const {
             if (endIndex > capacity) {
-                copy(loc, beginIndex, capacity);
-                copy(loc + capacity - beginIndex, 0, endIndex - capacity);
+                copy<MOVE>(loc, beginIndex, capacity);
+                copy<MOVE>(loc + capacity - beginIndex, 0, endIndex - capacity);
             } else {
-                copy(loc, beginIndex, endIndex);
+                copy<MOVE>(loc, beginIndex, endIndex);
             }
         }
 
+        template <bool MOVE>
         constexpr void copy(T* dest, size_t from, size_t to) const {
             if constexpr (std::is_trivially_copyable<T>::value) {
                 memcpy(dest, elements + from, (to - from) * sizeof(T));
+            } else if constexpr (MOVE) {
+                std::uninitialized_move(elements + from, elements + to, dest);
             } else {
-                std::move(elements + from, elements + to, dest);
+                std::uninitialized_copy(elements + from, elements + to, dest);
             }
         }
         
-        constexpr void reallocate(size_t cap) {
+        // The smallest power of GROWTH_FACTOR times the current capacity that fits cap elements.
+        constexpr size_t grownCapacity(size_t cap) const {
+            size_t newCap = capacity == 0 ? GROWTH_FACTOR : capacity;
+            while (newCap < cap) { newCap *= GROWTH_FACTOR; }
+            return newCap;
+        }
+
+        // appended is constructed after the elements before the old buffer is freed, so it may point into it.
+        constexpr void reallocate(size_t cap, std::span<const T> appended = { }) {
             T* newT = alloc.allocate(cap);
-            copyContents(newT);
+            construct(newT + size(), appended);
+            copyContents<true>(newT);
+            deleteElems();
             alloc.deallocate(elements, capacity);
             elements = newT;
-            endIndex = endIndex - beginIndex;
+            endIndex = endIndex - beginIndex + appended.size();
             beginIndex = 0;
             capacity = cap;
         }
@@ -60,6 +88,32 @@ class CircularArray {
             PGE_ASSERT_AT(size() != 0, "circular array was empty", loc);
         }
 
+        constexpr std::array<std::span<T>, 2> spansInternal() const {
+            if (endIndex > capacity) {
+                return { std::span(elements + beginIndex, capacity - beginIndex), std::span(elements, endIndex - capacity) };
+            }
+            return { std::span(elements + beginIndex, endIndex - beginIndex), std::span<T>() };
+        }
+
+        constexpr void wrapBegin() {
+            if (beginIndex >= capacity) {
+                beginIndex -= capacity;
+                endIndex -= capacity;
+            }
+        }
+
+        constexpr void construct(T* dest, std::span<const T> ts) {
+            if constexpr (std::is_trivially_copyable<T>::value) {
+                if (!ts.empty()) {
+                    memcpy(dest, ts.data(), ts.size() * sizeof(T));
+                }
+            } else {
+                for (size_t i : Range(ts.size())) {
+                    new (dest + i) T(ts[i]);
+                }
+            }
+        }
+
         constexpr T& frontInternal() const {
             assertNotEmpty();
             return elements[beginIndex];
@@ -67,12 +121,12 @@ class CircularArray {
 
         constexpr T& backInternal() const {
             assertNotEmpty();
-            return elements[(endIndex - 1) % capacity];
+            return elements[wrap(endIndex - 1)];
         }
         
         constexpr T& indexInternal(size_t index) const {
             PGE_ASSERT(index < size(), "index must be less than size");
-            return elements[(beginIndex + index) % capacity];
+            return elements[wrap(beginIndex + index)];
         }
 
         template <bool CONST>
@@ -109,7 +163,7 @@ class CircularArray {
 
                 constexpr std::conditional<CONST, const T&, T&>::type operator*() const {
                     PGE_ASSERT(pos < carr->endIndex, "tried dereferencing end iterator");
-                    return carr->elements[pos % carr->capacity];
+                    return carr->elements[carr->wrap(pos)];
                 }
 
                 constexpr BasicIterator& operator++() {
@@ -231,7 +285,7 @@ class CircularArray {
         constexpr void operator=(const CircularArray& other) {
             clear();
             reserve(other.size());
-            other.copyContents(elements);
+            other.copyContents<false>(elements);
             endIndex = other.size();
         }
 
@@ -275,8 +329,8 @@ class CircularArray {
             for (const T& t : ts) {
                 if (i >= endIndex) { return Ordering::less; }
 
-                if ((elements[i % capacity] <=> t) != Ordering::equivalent) {
-                    return elements[i % capacity] <=> t;
+                if ((elements[wrap(i)] <=> t) != Ordering::equivalent) {
+                    return elements[wrap(i)] <=> t;
                 }
                 i++;
             }
@@ -316,7 +370,7 @@ class CircularArray {
         template <typename... Args>
         constexpr T& emplaceFront(Args&&... args) {
             reserve(size() + 1);
-            beginIndex = (beginIndex - 1 + capacity) % capacity;
+            beginIndex = wrap(beginIndex - 1);
             if (beginIndex > endIndex) { endIndex += capacity; }
             T& newT = *new (elements + beginIndex) T(std::forward<Args>(args)...);
             return newT;
@@ -325,7 +379,7 @@ class CircularArray {
         template <typename... Args>
         constexpr T& emplaceBack(Args&&... args) {
             reserve(size() + 1);
-            T& newT = *new (elements + (endIndex % capacity)) T(std::forward<Args>(args)...);
+            T& newT = *new (elements + wrap(endIndex)) T(std::forward<Args>(args)...);
             endIndex++;
             return newT;
         }
@@ -350,16 +404,46 @@ class CircularArray {
             assertNotEmpty();
             elements[beginIndex].~T();
             beginIndex++;
-            if (beginIndex >= capacity) {
-                beginIndex %= capacity;
-                endIndex %= capacity;
-            }
+            wrapBegin();
         }
 
         constexpr void popBack() {
             assertNotEmpty();
             endIndex--;
-            elements[endIndex % capacity].~T();
+            elements[wrap(endIndex)].~T();
+        }
+
+        /// Appends all of ts, copying them in at most two pieces.
+        /// ts may be part of this array.
+        constexpr void pushBack(std::span<const T> ts) {
+            if (size() + ts.size() > capacity) {
+                reallocate(grownCapacity(size() + ts.size()), ts);
+                return;
+            }
+            size_t first = std::min(ts.size(), capacity - wrap(endIndex));
+            construct(elements + wrap(endIndex), ts.first(first));
+            construct(elements, ts.subspan(first));
+            endIndex += ts.size();
+        }
+
+        /// Removes the first count elements.
+        constexpr void popFront(size_t count) {
+            PGE_ASSERT(count <= size(), "Tried popping more elements than there are");
+            if constexpr (!std::is_trivially_destructible<T>::value) {
+                for (size_t i : Range(beginIndex, beginIndex + count)) {
+                    elements[wrap(i)].~T();
+                }
+            }
+            beginIndex += count;
+            wrapBegin();
+        }
+
+        /// The elements in order, split in two where they wrap around the end of the buffer.
+        /// The second span is empty if they don't.
+        constexpr std::array<std::span<T>, 2> asSpans() { return spansInternal(); }
+        constexpr std::array<std::span<const T>, 2> asSpans() const {
+            std::array<std::span<T>, 2> spans = spansInternal();
+            return { spans[0], spans[1] };
         }
 
         constexpr T& front() { return frontInternal(); }
@@ -381,9 +465,7 @@ class CircularArray {
 
         constexpr void reserve(size_t cap) {
             if (capacity >= cap) { return; }
-            size_t newCap = capacity == 0 ? GROWTH_FACTOR : capacity;
-            while (newCap < cap) { newCap *= GROWTH_FACTOR; }
-            reallocate(newCap);
+            reallocate(grownCapacity(cap));
         }
 
         constexpr void clear() {
@@ -0,0 +1,251 @@
+#ifndef PGE_FLATHASHMAP_H_INCLUDED
+#define PGE_FLATHASHMAP_H_INCLUDED
+
+#include <vector>
+#include <memory>
+#include <utility>
+#include <tuple>
+#include <algorithm>
+#include <functional>
+#include <bit>
+
+#include <PGE/Types/Types.h>
+#include <PGE/Types/Range.h>
+#include <PGE/Types/Simd.h>
+
+namespace PGE {
+
+/// An unordered map with open addressing, probing 16 slots at once with SIMD.
+/// The entries are stored contiguously in insertion order, which makes iterating as fast as iterating a vector.
+/// Erasing moves the last entry into the gap.
+/// Adding or erasing entries invalidates iterators and references.
+///
+/// Hash and Equal may be transparent to allow lookups with other types, like with std::unordered_map.
+/// Each slot keeps the full hash next to the entry's index, so lookups only compare keys if the hashes are equal,
+/// and growing never rehashes any keys.
+template <typename K, typename V, typename Hash = std::hash<K>, typename Equal = std::equal_to<K>>
+class FlatHashMap {
+    public:
+        using Entry = std::pair<const K, V>;
+        using Iterator = typename std::vector<Entry>::iterator;
+        using ConstIterator = typename std::vector<Entry>::const_iterator;
+
+    private:
+        static constexpr size_t GROUP_SIZE = 16;
+        static constexpr size_t NOT_FOUND = (size_t)-1;
+
+        // Taken slots have the lowest 7 bits of their hash as their control byte, so they never have the highest bit set.
+        static constexpr u8 EMPTY = 0x80;
+        static constexpr u8 DELETED = 0xFE;
+
+        struct Slot {
+            size_t hash;
+            u32 index;
+        };
+
+        std::vector<Entry> entries;
+        // Either empty or a power of two number of groups.
+        std::vector<u8> control;
+        std::vector<Slot> slots;
+        size_t deletedCount = 0;
+
+#if defined(PGE_SIMD_NEON)
+        // Each lane is represented by a nibble in the mask.
+        static constexpr int MASK_SHIFT = 2;
+#else
+        static constexpr int MASK_SHIFT = 0;
+#endif
+
+        /// A mask of the control bytes in the group that equal value, to be walked with #lowestMatch.
+        static u64 match(const u8* group, u8 value) {
+#if defined(PGE_SIMD_SSE2)
+            return (u64)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)group), _mm_set1_epi8((char)value)));
+#elif defined(PGE_SIMD_NEON)
+            uint8x16_t equal = vceqq_u8(vld1q_u8(group), vdupq_n_u8(value));
+            return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0) & 0x8888888888888888u;
+#else
+            u64 mask = 0;
+            for (size_t i : Range(GROUP_SIZE)) {
+                mask |= (u64)(group[i] == value) << i;
+            }
+            return mask;
+#endif
+        }
+
+        static size_t lowestMatch(u64 mask) {
+            return (size_t)std::countr_zero(mask) >> MASK_SHIFT;
+        }
+
+        // Triangular probing over the groups, which visits every group once as their count is a power of two.
+        size_t firstGroup(size_t hash) const {
+            return (hash >> 7) & (control.size() / GROUP_SIZE - 1);
+        }
+
+        size_t nextGroup(size_t group, size_t step) const {
+            return (group + step) & (control.size() / GROUP_SIZE - 1);
+        }
+
+        template <typename Q>
+        size_t findSlot(const Q& key, size_t hash) const {
+            if (entries.empty()) { return NOT_FOUND; }
+            u8 h2 = (u8)(hash & 0x7F);
+            for (size_t group = firstGroup(hash), step = 1; ; group = nextGroup(group, step++)) {
+                const u8* groupControl = control.data() + group * GROUP_SIZE;
+                for (u64 mask = match(groupControl, h2); mask != 0; mask &= mask - 1) {
+                    size_t slot = group * GROUP_SIZE + lowestMatch(mask);
+                    if (slots[slot].hash == hash && Equal()(entries[slots[slot].index].first, key)) {
+                        return slot;
+                    }
+                }
+                // A key is never placed beyond a group that has room.
+                if (match(groupControl, EMPTY) != 0) { return NOT_FOUND; }
+            }
+        }
+
+        size_t findSlotOfIndex(size_t hash, u32 index) const {
+            u8 h2 = (u8)(hash & 0x7F);
+            for (size_t group = firstGroup(hash), step = 1; ; group = nextGroup(group, step++)) {
+                for (u64 mask = match(control.data() + group * GROUP_SIZE, h2); mask != 0; mask &= mask - 1) {
+                    size_t slot = group * GROUP_SIZE + lowestMatch(mask);
+                    if (slots[slot].index == index) { return slot; }
+                }
+            }
+        }
+
+        void insertSlot(size_t hash, u32 index) {
+            for (size_t group = firstGroup(hash), step = 1; ; group = nextGroup(group, step++)) {
+                const u8* groupControl = control.data() + group * GROUP_SIZE;
+                u64 free = match(groupControl, EMPTY) | match(groupControl, DELETED);
+                if (free != 0) {
+                    size_t slot = group * GROUP_SIZE + lowestMatch(free);
+                    deletedCount -= control[slot] == DELETED;
+                    control[slot] = (u8)(hash & 0x7F);
+                    slots[slot] = { hash, index };
+                    return;
+                }
+            }
+        }
+
+        /// Makes room for count entries, keeping at least an eighth of the slots empty so that probing terminates quickly.
+        void reserveSlots(size_t count) {
+            if ((count + deletedCount) * 8 <= control.size() * 7) { return; }
+            // Getting rid of deleted slots may be enough, in which case the size stays the same.
+            size_t slotCount = std::max(GROUP_SIZE, std::bit_ceil(count * 8 / 7 + 1));
+            std::vector<u8> oldControl = std::exchange(control, std::vector<u8>(slotCount, EMPTY));
+            std::vector<Slot> oldSlots = std::exchange(slots, std::vector<Slot>(slotCount));
+            deletedCount = 0;
+            for (size_t i : Range(oldControl.size())) {
+                if ((oldControl[i] & 0x80) == 0) {
+                    insertSlot(oldSlots[i].hash, oldSlots[i].index);
+                }
+            }
+        }
+
+    public:
+        FlatHashMap() = default;
+        FlatHashMap(const FlatHashMap& other) = default;
+        FlatHashMap(FlatHashMap&& other) noexcept = default;
+
+        // The entries can't be assigned to because of their const keys, so assigning makes a new copy.
+        FlatHashMap& operator=(const FlatHashMap& other) {
+            if (this != &other) {
+                *this = FlatHashMap(other);
+            }
+            return *this;
+        }
+
+        FlatHashMap& operator=(FlatHashMap&& other) noexcept = default;
+
+        /// Order independent.
+        bool operator==(const FlatHashMap& other) const {
+            if (size() != other.size()) { return false; }
+            for (const Entry& entry : entries) {
+                ConstIterator it = other.find(entry.first);
+                if (it == other.end() || !(it->second == entry.second)) { return false; }
+            }
+            return true;
+        }
+
+        /// Constructs the value from args if key isn't in the map yet.
+        /// @returns The entry of key and whether it was added.
+        template <typename... Args>
+        std::pair<Iterator, bool> emplace(K key, Args&&... args) {
+            size_t hash = Hash()(key);
+            size_t slot = findSlot(key, hash);
+            if (slot != NOT_FOUND) {
+                return { entries.begin() + slots[slot].index, false };
+            }
+            reserveSlots(entries.size() + 1);
+            entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+            insertSlot(hash, (u32)(entries.size() - 1));
+            return { entries.end() - 1, true };
+        }
+
+        /// Adds a default constructed value if key isn't in the map yet.
+        V& operator[](const K& key) {
+            return emplace(key).first->second;
+        }
+
+        template <typename Q>
+        Iterator find(const Q& key) {
+            size_t slot = findSlot(key, Hash()(key));
+            return slot != NOT_FOUND ? entries.begin() + slots[slot].index : entries.end();
+        }
+
+        template <typename Q>
+        ConstIterator find(const Q& key) const {
+            size_t slot = findSlot(key, Hash()(key));
+            return slot != NOT_FOUND ? entries.begin() + slots[slot].index : entries.end();
+        }
+
+        template <typename Q>
+        bool contains(const Q& key) const {
+            return findSlot(key, Hash()(key)) != NOT_FOUND;
+        }
+
+        /// @returns The number of entries erased, 0 or 1.
+        template <typename Q>
+        size_t erase(const Q& key) {
+            size_t slot = findSlot(key, Hash()(key));
+            if (slot == NOT_FOUND) { return 0; }
+
+            u32 index = slots[slot].index;
+            // Lookups only ever probe past full groups, so the slot can be emptied if the group wasn't full.
+            size_t groupStart = slot / GROUP_SIZE * GROUP_SIZE;
+            bool groupHasRoom = match(control.data() + groupStart, EMPTY) != 0;
+            control[slot] = groupHasRoom ? EMPTY : DELETED;
+            deletedCount += !groupHasRoom;
+
+            u32 last = (u32)(entries.size() - 1);
+            if (index != last) {
+                slots[findSlotOfIndex(Hash()(entries[last].first), last)].index = index;
+                std::destroy_at(&entries[index]);
+                std::construct_at(&entries[index], std::move(entries[last]));
+            }
+            entries.pop_back();
+            return 1;
+        }
+
+        void reserve(size_t count) {
+            entries.reserve(count);
+            reserveSlots(count);
+        }
+
+        void clear() {
+            entries.clear();
+            std::fill(control.begin(), control.end(), EMPTY);
+            deletedCount = 0;
+        }
+
+        size_t size() const { return entries.size(); }
+        bool empty() const { return entries.empty(); }
+
+        Iterator begin() { return entries.begin(); }
+        Iterator end() { return entries.end(); }
+        ConstIterator begin() const { return entries.begin(); }
+        ConstIterator end() const { return entries.end(); }
+};
+
+}
+
+#endif // PGE_FLATHASHMAP_H_INCLUDED
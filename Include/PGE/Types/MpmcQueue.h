@@ -0,0 +1,141 @@
+#ifndef PGE_MPMCQUEUE_H_INCLUDED
+#define PGE_MPMCQUEUE_H_INCLUDED
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <algorithm>
+#include <new>
+#include <bit>
+#include <type_traits>
+
+#include <PGE/Types/Types.h>
+#include <PGE/Types/Range.h>
+
+namespace PGE {
+
+/// A bounded queue that any number of threads can push to and pop from at once, without locking.
+/// Elements pushed by one thread are popped in the order they were pushed in.
+/// The capacity is fixed and rounded up to a power of two, at least 2.
+/// @see #PGE::SpscRing for a cheaper queue between exactly two threads.
+template <typename T>
+class MpmcQueue {
+    // Popping moves the element out of a cell that has already been claimed, which can't be undone.
+    static_assert(std::is_nothrow_move_constructible<T>::value, "Elements must be nothrow move constructible");
+
+    private:
+        // Each cell's sequence number tells which lap around the buffer it is ready for:
+        // Equal to the position a producer wants to write to when the cell is free, one past it once the element is in.
+        struct Cell {
+            std::atomic<size_t> sequence;
+            alignas(T) byte storage[sizeof(T)];
+
+            T* get() { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+        const size_t capacity;
+        const std::unique_ptr<Cell[]> cells;
+
+        // Producers and consumers each contend on their own cache line.
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos = 0;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos = 0;
+
+    public:
+        explicit MpmcQueue(size_t cap)
+            : capacity(std::bit_ceil(std::max(cap, (size_t)2))), cells(std::make_unique<Cell[]>(capacity)) {
+            for (size_t i : Range(capacity)) {
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        ~MpmcQueue() {
+            if constexpr (!std::is_trivially_destructible<T>::value) {
+                for (size_t i : Range(dequeuePos.load(std::memory_order_relaxed), enqueuePos.load(std::memory_order_relaxed))) {
+                    cells[i & (capacity - 1)].get()->~T();
+                }
+            }
+        }
+
+        /// Elements that may throw while being constructed from args are constructed before looking for room,
+        /// as a cell that was claimed has to be filled.
+        /// @returns Whether there was room for the element.
+        template <typename... Args>
+        bool tryEmplaceBack(Args&&... args) {
+            if constexpr (!std::is_nothrow_constructible<T, Args&&...>::value) {
+                return tryEmplaceBack(T(std::forward<Args>(args)...));
+            } else {
+                size_t pos = enqueuePos.load(std::memory_order_relaxed);
+                Cell* cell;
+                while (true) {
+                    cell = &cells[pos & (capacity - 1)];
+                    // Acquiring makes sure the consumer of the previous lap is done with the cell.
+                    size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                    i64 diff = (i64)(sequence - pos);
+                    if (diff == 0) {
+                        // The cell is free, claiming the position makes it ours.
+                        if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+                    } else if (diff < 0) {
+                        // The cell still holds the element from the previous lap.
+                        return false;
+                    } else {
+                        // Another producer claimed the position first.
+                        pos = enqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+                new (cell->get()) T(std::forward<Args>(args)...);
+                cell->sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+
+        bool tryPushBack(const T& t) { return tryEmplaceBack(t); }
+        bool tryPushBack(T&& t) { return tryEmplaceBack(std::move(t)); }
+
+        /// @returns The front element, or nothing if the queue is empty.
+        std::optional<T> tryPopFront() {
+            size_t pos = dequeuePos.load(std::memory_order_relaxed);
+            Cell* cell;
+            while (true) {
+                cell = &cells[pos & (capacity - 1)];
+                // Acquiring makes the producer's element visible.
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                i64 diff = (i64)(sequence - (pos + 1));
+                if (diff == 0) {
+                    if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+                } else if (diff < 0) {
+                    // Nothing was pushed to the cell in this lap yet.
+                    return std::nullopt;
+                } else {
+                    pos = dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            T* elem = cell->get();
+            std::optional<T> ret(std::move(*elem));
+            elem->~T();
+            // Frees the cell for the producer of the next lap.
+            cell->sequence.store(pos + capacity, std::memory_order_release);
+            return ret;
+        }
+
+        /// A snapshot that may be outdated by the time it returns.
+        size_t size() const {
+            size_t dequeued = dequeuePos.load(std::memory_order_relaxed);
+            size_t enqueued = enqueuePos.load(std::memory_order_relaxed);
+            return enqueued > dequeued ? std::min(enqueued - dequeued, capacity) : 0;
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        size_t getCapacity() const {
+            return capacity;
+        }
+};
+
+}
+
+#endif // PGE_MPMCQUEUE_H_INCLUDED
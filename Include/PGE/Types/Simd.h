@@ -0,0 +1,22 @@
+#ifndef PGE_SIMD_H_INCLUDED
+#define PGE_SIMD_H_INCLUDED
+
+// The instruction set is picked at compile time.
+// x86 and x64 builds can always rely on SSE2, AVX2 is only used when the compiler is allowed to emit it (/arch:AVX2, -mavx2).
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define PGE_SIMD_SSE2
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define PGE_SIMD_AVX2
+#include <immintrin.h>
+#endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define PGE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(PGE_SIMD_SSE2) || defined(PGE_SIMD_NEON)
+#define PGE_SIMD
+#endif
+
+#endif // PGE_SIMD_H_INCLUDED
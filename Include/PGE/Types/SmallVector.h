@@ -0,0 +1,277 @@
+#ifndef PGE_SMALLVECTOR_H_INCLUDED
+#define PGE_SMALLVECTOR_H_INCLUDED
+
+#include <memory>
+#include <algorithm>
+#include <utility>
+
+#include <PGE/Types/Types.h>
+#include <PGE/Types/Concepts.h>
+#include <PGE/Types/Reference.h>
+#include <PGE/Exception/Exception.h>
+
+namespace PGE {
+
+/// A vector that keeps up to N elements inside of itself, only allocating once it grows beyond that.
+/// Meant for short lists that are created often.
+/// Moving one whose elements are stored inline moves the elements one by one.
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(N > 0, "Use std::vector for no inline elements");
+
+    private:
+        static constexpr size_t GROWTH_FACTOR = 2;
+
+        T* elements;
+        size_t count = 0;
+        size_t allocatedCount = N;
+        alignas(T) byte inlineStorage[N * sizeof(T)];
+
+        T* getInlineElements() {
+            return reinterpret_cast<T*>(inlineStorage);
+        }
+
+        bool isInline() const {
+            return elements == reinterpret_cast<const T*>(inlineStorage);
+        }
+
+        void freeElements() {
+            if (!isInline()) {
+                std::allocator<T>().deallocate(elements, allocatedCount);
+            }
+        }
+
+        void reallocate(size_t cap) {
+            T* newElements = std::allocator<T>().allocate(cap);
+            std::uninitialized_move_n(elements, count, newElements);
+            std::destroy_n(elements, count);
+            freeElements();
+            elements = newElements;
+            allocatedCount = cap;
+        }
+
+        void assertIndex(size_t index) const {
+            PGE_ASSERT(index < count, "index must be less than size");
+        }
+
+    public:
+        using Iterator = T*;
+        using ConstIterator = const T*;
+
+        SmallVector() : elements(getInlineElements()) { }
+
+        SmallVector(const SmallVector& other) : SmallVector() {
+            *this = other;
+        }
+
+        SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) : SmallVector() {
+            *this = std::move(other);
+        }
+
+        SmallVector(size_t cnt, const T& value) : SmallVector() {
+            reserve(cnt);
+            std::uninitialized_fill_n(elements, cnt, value);
+            count = cnt;
+        }
+
+        SmallVector(const Enumerable<T> auto& ts) : SmallVector() {
+            *this = ts;
+        }
+
+        SmallVector(const std::initializer_list<T>& ts) : SmallVector() {
+            *this = ts;
+        }
+
+        ~SmallVector() {
+            clear();
+            freeElements();
+        }
+
+        void operator=(const SmallVector& other) {
+            if (this == &other) { return; }
+            this->operator=<SmallVector>(other);
+        }
+
+        void operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+            if (this == &other) { return; }
+            clear();
+            if (other.isInline()) {
+                // Always fits, there's at least as much room here.
+                std::uninitialized_move_n(other.elements, other.count, elements);
+                count = other.count;
+                other.clear();
+            } else {
+                freeElements();
+                elements = std::exchange(other.elements, other.getInlineElements());
+                allocatedCount = std::exchange(other.allocatedCount, N);
+                count = std::exchange(other.count, 0);
+            }
+        }
+
+        void operator=(const Enumerable<T> auto& ts) {
+            clear();
+            if constexpr (std::ranges::sized_range<decltype(ts)>) {
+                reserve(std::ranges::size(ts));
+            }
+            for (const T& t : ts) {
+                emplace_back(t);
+            }
+        }
+
+        void operator=(const std::initializer_list<T>& ts) {
+            this->operator=<std::initializer_list<T>>(ts);
+        }
+
+        bool operator==(const Enumerable<T> auto& ts) const {
+            return std::ranges::equal(*this, ts);
+        }
+
+        Iterator begin() { return elements; }
+        Iterator end() { return elements + count; }
+        ConstIterator begin() const { return elements; }
+        ConstIterator end() const { return elements + count; }
+
+        T* data() { return elements; }
+        const T* data() const { return elements; }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args) {
+            if (count == allocatedCount) {
+                // args may refer to an element, which growing would move out from under them.
+                T t(std::forward<Args>(args)...);
+                reserve(count + 1);
+                return *new (elements + count++) T(std::move(t));
+            }
+            return *new (elements + count++) T(std::forward<Args>(args)...);
+        }
+
+        void push_back(const T& t) {
+            emplace_back(t);
+        }
+
+        void push_back(T&& t) {
+            emplace_back(std::move(t));
+        }
+
+        void pop_back() {
+            PGE_ASSERT(count != 0, "small vector was empty");
+            std::destroy_at(elements + --count);
+        }
+
+        template <typename... Args>
+        Iterator emplace(ConstIterator pos, Args&&... args) {
+            size_t index = pos - elements;
+            PGE_ASSERT(index <= count, "position must be within the small vector");
+            if (index == count) {
+                emplace_back(std::forward<Args>(args)...);
+                return elements + index;
+            }
+            // Constructed up front for the same reason as in emplace_back, and because shifting may overwrite what args refer to.
+            T t(std::forward<Args>(args)...);
+            reserve(count + 1);
+            new (elements + count) T(std::move(elements[count - 1]));
+            std::move_backward(elements + index, elements + count - 1, elements + count);
+            count++;
+            elements[index] = std::move(t);
+            return elements + index;
+        }
+
+        Iterator insert(ConstIterator pos, const T& t) {
+            return emplace(pos, t);
+        }
+
+        Iterator insert(ConstIterator pos, T&& t) {
+            return emplace(pos, std::move(t));
+        }
+
+        Iterator erase(ConstIterator pos) {
+            return erase(pos, pos + 1);
+        }
+
+        Iterator erase(ConstIterator first, ConstIterator last) {
+            size_t index = first - elements;
+            size_t removed = last - first;
+            PGE_ASSERT(first <= last && index + removed <= count, "range must be within the small vector");
+            std::move(elements + index + removed, elements + count, elements + index);
+            std::destroy_n(elements + count - removed, removed);
+            count -= removed;
+            return elements + index;
+        }
+
+        // CircularArray style names.
+        template <typename... Args>
+        T& emplaceBack(Args&&... args) { return emplace_back(std::forward<Args>(args)...); }
+        void pushBack(const T& t) { push_back(t); }
+        void pushBack(T&& t) { push_back(std::move(t)); }
+        void popBack() { pop_back(); }
+
+        T& front() { assertIndex(0); return elements[0]; }
+        const T& front() const { assertIndex(0); return elements[0]; }
+
+        T& back() { assertIndex(0); return elements[count - 1]; }
+        const T& back() const { assertIndex(0); return elements[count - 1]; }
+
+        T& operator[](size_t index) { assertIndex(index); return elements[index]; }
+        const T& operator[](size_t index) const { assertIndex(index); return elements[index]; }
+
+        T& at(size_t index) { assertIndex(index); return elements[index]; }
+        const T& at(size_t index) const { assertIndex(index); return elements[index]; }
+
+        bool empty() const {
+            return count == 0;
+        }
+
+        size_t size() const {
+            return count;
+        }
+
+        size_t capacity() const {
+            return allocatedCount;
+        }
+
+        size_t getCapacity() const {
+            return allocatedCount;
+        }
+
+        /// Whether the elements have outgrown the inline storage.
+        bool isAllocated() const {
+            return !isInline();
+        }
+
+        void reserve(size_t cap) {
+            if (allocatedCount >= cap) { return; }
+            reallocate(std::max(cap, allocatedCount * GROWTH_FACTOR));
+        }
+
+        /// New elements are value initialized.
+        void resize(size_t cnt) {
+            if (cnt <= count) {
+                std::destroy_n(elements + cnt, count - cnt);
+            } else {
+                reserve(cnt);
+                std::uninitialized_value_construct_n(elements + count, cnt - count);
+            }
+            count = cnt;
+        }
+
+        void resize(size_t cnt, const T& value) {
+            if (cnt <= count) {
+                std::destroy_n(elements + cnt, count - cnt);
+            } else {
+                // value may be an element.
+                T t(value);
+                reserve(cnt);
+                std::uninitialized_fill_n(elements + count, cnt - count, t);
+            }
+            count = cnt;
+        }
+
+        void clear() {
+            std::destroy_n(elements, count);
+            count = 0;
+        }
+};
+
+}
+
+#endif // PGE_SMALLVECTOR_H_INCLUDED
@@ -0,0 +1,170 @@
+#ifndef PGE_SPSCRING_H_INCLUDED
+#define PGE_SPSCRING_H_INCLUDED
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <algorithm>
+#include <span>
+#include <bit>
+#include <cstring>
+
+#include <PGE/Types/Types.h>
+#include <PGE/Types/Range.h>
+
+namespace PGE {
+
+/// A bounded queue that one thread pushes to and another one pops from, without locking.
+/// Only one thread at a time may push and only one thread at a time may pop, #size and #empty may be called from either.
+/// The capacity is fixed and rounded up to a power of two.
+/// @see #PGE::MpmcQueue for multiple producers or consumers.
+template <typename T>
+class SpscRing {
+    private:
+        const size_t capacity;
+        T* const elements;
+
+        // The producer's and the consumer's indices each live on their own cache line.
+        // The indices only ever grow, they are wrapped around when accessing elements.
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail = 0;
+        // The last head the producer saw, only reloaded when the ring looks full.
+        size_t cachedHead = 0;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> head = 0;
+        // The last tail the consumer saw, only reloaded when the ring looks empty.
+        size_t cachedTail = 0;
+
+        size_t wrap(size_t index) const {
+            return index & (capacity - 1);
+        }
+
+        void construct(T* dest, std::span<const T> ts) {
+            if constexpr (std::is_trivially_copyable<T>::value) {
+                if (!ts.empty()) {
+                    memcpy(dest, ts.data(), ts.size() * sizeof(T));
+                }
+            } else {
+                // Destroys the copies made so far if one throws.
+                std::uninitialized_copy(ts.begin(), ts.end(), dest);
+            }
+        }
+
+        void moveOut(T* src, std::span<T> dest) {
+            if constexpr (std::is_trivially_copyable<T>::value) {
+                if (!dest.empty()) {
+                    memcpy(dest.data(), src, dest.size() * sizeof(T));
+                }
+            } else {
+                for (size_t i : Range(dest.size())) {
+                    dest[i] = std::move(src[i]);
+                    src[i].~T();
+                }
+            }
+        }
+
+    public:
+        explicit SpscRing(size_t cap)
+            : capacity(std::bit_ceil(std::max(cap, (size_t)1))), elements(std::allocator<T>().allocate(capacity)) { }
+
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        ~SpscRing() {
+            if constexpr (!std::is_trivially_destructible<T>::value) {
+                for (size_t i : Range(head.load(std::memory_order_relaxed), tail.load(std::memory_order_relaxed))) {
+                    elements[wrap(i)].~T();
+                }
+            }
+            std::allocator<T>().deallocate(elements, capacity);
+        }
+
+        /// Producer only.
+        /// @returns Whether there was room for the element.
+        template <typename... Args>
+        bool tryEmplaceBack(Args&&... args) {
+            size_t t = tail.load(std::memory_order_relaxed);
+            if (t - cachedHead == capacity) {
+                // Acquiring makes sure the consumer is done with the element before it is overwritten.
+                cachedHead = head.load(std::memory_order_acquire);
+                if (t - cachedHead == capacity) { return false; }
+            }
+            new (elements + wrap(t)) T(std::forward<Args>(args)...);
+            // Releasing publishes the element along with the index.
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool tryPushBack(const T& t) { return tryEmplaceBack(t); }
+        bool tryPushBack(T&& t) { return tryEmplaceBack(std::move(t)); }
+
+        /// Producer only, pushes as many of ts as there is room for, publishing them all at once.
+        /// If copying an element throws, none of them are pushed.
+        /// @returns The number of elements pushed, from the front of ts.
+        size_t tryPushBack(std::span<const T> ts) {
+            size_t t = tail.load(std::memory_order_relaxed);
+            if (capacity - (t - cachedHead) < ts.size()) {
+                cachedHead = head.load(std::memory_order_acquire);
+            }
+            size_t count = std::min(ts.size(), capacity - (t - cachedHead));
+            size_t first = std::min(count, capacity - wrap(t));
+            construct(elements + wrap(t), ts.first(first));
+            try {
+                construct(elements, ts.subspan(first, count - first));
+            } catch (...) {
+                std::destroy_n(elements + wrap(t), first);
+                throw;
+            }
+            tail.store(t + count, std::memory_order_release);
+            return count;
+        }
+
+        /// Consumer only.
+        /// @returns The front element, or nothing if the ring is empty.
+        std::optional<T> tryPopFront() {
+            size_t h = head.load(std::memory_order_relaxed);
+            if (h == cachedTail) {
+                cachedTail = tail.load(std::memory_order_acquire);
+                if (h == cachedTail) { return std::nullopt; }
+            }
+            T& elem = elements[wrap(h)];
+            std::optional<T> ret(std::move(elem));
+            elem.~T();
+            head.store(h + 1, std::memory_order_release);
+            return ret;
+        }
+
+        /// Consumer only, moves as many elements as there are into dest, up to its size.
+        /// @returns The number of elements popped to the front of dest.
+        size_t tryPopFront(std::span<T> dest) {
+            size_t h = head.load(std::memory_order_relaxed);
+            if (cachedTail - h < dest.size()) {
+                cachedTail = tail.load(std::memory_order_acquire);
+            }
+            size_t count = std::min(dest.size(), cachedTail - h);
+            size_t first = std::min(count, capacity - wrap(h));
+            moveOut(elements + wrap(h), dest.first(first));
+            moveOut(elements, dest.subspan(first, count - first));
+            head.store(h + count, std::memory_order_release);
+            return count;
+        }
+
+        /// Exact when called from the producer or the consumer while the other one is idle, a snapshot otherwise.
+        size_t size() const {
+            // Loading head first keeps the difference from going negative, as the tail never falls behind it.
+            size_t h = head.load(std::memory_order_acquire);
+            size_t t = tail.load(std::memory_order_acquire);
+            return std::min(t - h, capacity);
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        size_t getCapacity() const {
+            return capacity;
+        }
+};
+
+}
+
+#endif // PGE_SPSCRING_H_INCLUDED
@@ -3,10 +3,10 @@
 
 #include <algorithm>
 
-#include <PGE/String/String.h>
-
 namespace PGE {
 
+class String;
+
 template <size_t N>
 struct TemplateString {
 	public:
@@ -15,7 +15,8 @@ struct TemplateString {
 		consteval TemplateString(const char(&cstri)[N]) { std::copy_n(cstri, N, cstr); }
 
 		constexpr operator const char*() const { return cstr; }
-		constexpr operator String() const { return String(cstr); }
+		// Defined in String.h, which depends on this header.
+		operator String() const;
 };
 
 }
@@ -2,6 +2,7 @@
 #define PGE_TYPES_H_INCLUDED
 
 #include <stdint.h>
+#include <stddef.h>
 #include <vector>
 
 #include "Reference.h"
@@ -27,8 +28,16 @@ using char16 = wchar_t;
 using char16 = char16_t;
 #endif
 
+// Assumed size of a cache line, data written by different threads is kept this far apart.
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+// Defined in SmallVector.h, which has to be included to create or use one.
+template <typename T, size_t N>
+class SmallVector;
+
+/// Most lists of textures hold at most one per render target slot.
 template <typename T>
-using ReferenceVector = std::vector<Reference<T>>;
+using ReferenceVector = SmallVector<Reference<T>, 8>;
 
 }
 
@@ -10,12 +10,11 @@ using namespace PGE;
 static const inline String INVALID_EX = ">>> INVALID EXCEPTION <<<";
 
 Exception::Exception(const String& info, const std::source_location& location) noexcept {
-    String ex = location.file_name() + '(' + String::from(location.line()) +
-        ',' + String::from(location.column()) + "): "+ location.function_name();
-    if (!info.isEmpty()) {
-        ex += '\n' + info;
+    if (info.isEmpty()) {
+        this->info = String::format<"{}({},{}): {}">(location.file_name(), location.line(), location.column(), location.function_name());
+    } else {
+        this->info = String::format<"{}({},{}): {}\n{}">(location.file_name(), location.line(), location.column(), location.function_name(), info);
     }
-    this->info = ex;
 #ifdef DEBUG
     std::cout << what() << std::endl;
 #endif
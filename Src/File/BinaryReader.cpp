@@ -1,6 +1,7 @@
 #include <PGE/File/BinaryReader.h>
 
 #include <PGE/Types/Range.h>
+#include <PGE/String/StringBuilder.h>
 
 #include "../String/UnicodeHelper.h"
 
@@ -25,12 +26,13 @@ template<> bool BinaryReader::tryRead(char16& out) {
 }
 
 template<> bool BinaryReader::tryRead(String& out) {
-    out = String();
+    StringBuilder builder;
     char16 ch;
     bool succ;
     while ((succ = tryRead<char16>(ch)) && ch != 0) {
-        out += ch;
+        builder.append(ch);
     }
+    out = builder.build();
     return succ;
 }
 
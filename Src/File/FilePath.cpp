@@ -93,7 +93,7 @@ bool FilePath::isDirectory() const {
     PGE_ASSERT(valid, INVALID_STR);
     std::error_code err;
     bool isDir = std::filesystem::is_directory(str().c8str(), err);
-    PGE_ASSERT(err.value() == 0, "Couldn't check if path is directory (dir: " + str() + "; err: " + err.message() + " (" + PGE::String::from(err.value()) + "))");
+    PGE_ASSERT(err.value() == 0, String::concat("Couldn't check if path is directory (dir: ", str(), "; err: ", String(err.message()), " (", String::from(err.value()), "))"));
     return isDir;
 }
 
@@ -151,7 +151,7 @@ bool FilePath::exists() const {
     PGE_ASSERT(valid, INVALID_STR);
     std::error_code err;
     bool exists = std::filesystem::exists(str().c8str(), err);
-    PGE_ASSERT(err.value() == 0, "Couldn't check if directory exists (dir: " + str() + "; err: " + err.message() + " (" + PGE::String::from(err.value()) + "))");
+    PGE_ASSERT(err.value() == 0, String::concat("Couldn't check if directory exists (dir: ", str(), "; err: ", String(err.message()), " (", String::from(err.value()), "))"));
     return exists;
 }
 
@@ -159,7 +159,7 @@ u64 FilePath::getLastModifyTime() const {
     PGE_ASSERT(valid, INVALID_STR);
     std::error_code err;
     std::filesystem::file_time_type time = std::filesystem::last_write_time(str().c8str(), err);
-    PGE_ASSERT(err.value() == 0, "Couldn't check directory modify time (dir: " + str() + "; err: " + err.message() + " (" + PGE::String::from(err.value()) + "))");
+    PGE_ASSERT(err.value() == 0, String::concat("Couldn't check directory modify time (dir: ", str(), "; err: ", String(err.message()), " (", String::from(err.value()), "))"));
     return time.time_since_epoch().count();
 }
 
@@ -167,7 +167,7 @@ bool FilePath::createDirectory() const {
     PGE_ASSERT(valid, INVALID_STR);
     std::error_code err;
     bool created = std::filesystem::create_directories(str().c8str(), err);
-    PGE_ASSERT(err.value() == 0, "Couldn't create directory (dir: " + str() + "; err: " + err.message() + " (" + PGE::String::from(err.value()) + "))");
+    PGE_ASSERT(err.value() == 0, String::concat("Couldn't create directory (dir: ", str(), "; err: ", String(err.message()), " (", String::from(err.value()), "))"));
     return created;
 }
 
@@ -1,11 +1,14 @@
 #include <PGE/File/TextReader.h>
 
+#include <PGE/String/StringBuilder.h>
+
 #include "../String/UnicodeHelper.h"
 
 using namespace PGE;
 
 static const String INVALID_ENCODING("Invalid encoding (Don't cast ints to Encoding)");
 static const String UNEXPECTED_EOF("Encountered an unexpected end of file");
+static const String INVALID_UTF8("Encountered malformed UTF-8");
 
 TextReader::TextReader(const FilePath& file, Encoding enc)
     : AbstractIO(file) {
@@ -43,12 +46,23 @@ String TextReader::readLine() {
 }
 
 void TextReader::readLine(String& dest) {
+    if (encoding == Encoding::UTF8) {
+        readUtf8Line(dest);
+        return;
+    }
+    if (encoding == Encoding::UTF16LE || encoding == Encoding::UTF16BE) {
+        readUtf16Line(dest);
+        return;
+    }
+
+    StringBuilder builder(std::move(dest));
     // readChar takes care of checking for EOL.
     char16 ch = readChar();
     while (!eof && ch != L'\r' && ch != L'\n') {
-        dest += ch;
+        builder.append(ch);
         ch = readChar();
     }
+    dest = builder.build();
     if (!eof) {
         // Pure carriage return linebreak are a thing!
         char16 checkChar = ch == L'\r' ? L'\n' : L'\r';
@@ -59,6 +73,92 @@ void TextReader::readLine(String& dest) {
     }
 }
 
+void TextReader::readUtf8Line(String& dest) {
+    std::streambuf* buf = stream.rdbuf();
+    int ch = buf->sbumpc();
+    if (ch == EOF) {
+        reportEOF();
+        return;
+    }
+
+    // Line endings are ASCII and can't be part of a multi-byte sequence, so the line's bytes are collected as-is and validated in bulk.
+    lineBytes.clear();
+    while (ch != EOF && ch != '\r' && ch != '\n') {
+        lineBytes.push_back((char)ch);
+        ch = buf->sbumpc();
+    }
+
+    // dest is left untouched if the line is malformed.
+    int charCount;
+    PGE_ASSERT(Unicode::validateAndCount(lineBytes.data(), (int)lineBytes.size(), charCount), INVALID_UTF8);
+    StringBuilder builder(std::move(dest));
+    builder.appendBytes(lineBytes, charCount);
+    dest = builder.build();
+
+    if (ch == EOF) {
+        eof = true;
+    } else {
+        // Pure carriage return linebreak are a thing!
+        int checkChar = ch == '\r' ? '\n' : '\r';
+        if (buf->sgetc() == checkChar) {
+            buf->sbumpc();
+        }
+    }
+}
+
+char16 TextReader::readUtf16Unit(std::streambuf* buf, int& bytesRead) {
+    char bytes[2] = { };
+    bytesRead = (int)buf->sgetn(bytes, 2);
+    if (encoding == Encoding::UTF16LE) {
+        return (char16)((byte)bytes[0] | ((byte)bytes[1] << 8));
+    } else {
+        return (char16)(((byte)bytes[0] << 8) | (byte)bytes[1]);
+    }
+}
+
+void TextReader::readUtf16Line(String& dest) {
+    std::streambuf* buf = stream.rdbuf();
+    // The units are collected and transcoded to UTF-8 in one go once the line is complete.
+    lineUnits.clear();
+    int bytesRead;
+    char16 ch = readUtf16Unit(buf, bytesRead);
+    while (bytesRead == 2 && ch != L'\r' && ch != L'\n') {
+        lineUnits.push_back(ch);
+        ch = readUtf16Unit(buf, bytesRead);
+    }
+    if (bytesRead == 1) {
+        reportEOF();
+        throw Exception(UNEXPECTED_EOF);
+    }
+    if (bytesRead == 0) {
+        reportEOF();
+        if (lineUnits.empty()) {
+            return;
+        }
+    }
+
+    StringBuilder builder(std::move(dest));
+    try {
+        builder.appendUtf16(lineUnits);
+    } catch (...) {
+        // The builder is left as it was, so dest gets its content back.
+        dest = builder.build();
+        throw;
+    }
+    dest = builder.build();
+
+    if (!eof) {
+        // Pure carriage return linebreak are a thing!
+        char16 checkChar = ch == L'\r' ? L'\n' : L'\r';
+        char16 next = readUtf16Unit(buf, bytesRead);
+        if (bytesRead != 2 || next != checkChar) {
+            for (PGE_IT : Range(bytesRead)) {
+                buf->sungetc();
+            }
+        }
+    }
+}
+
 char16 TextReader::readChar() {
     switch (encoding) {
         using enum Encoding;
@@ -15,7 +15,7 @@ GraphicsDX11::GraphicsDX11(const String& name, int w, int h, WindowMode wm, int
         PGE_ASSERT(displayIndex >= 0, "Failed to determine display index (SDLERROR: " + String(SDL_GetError()) + ")");
         int errorCode = SDL_GetDisplayBounds(displayIndex, &displayBounds);
         PGE_ASSERT(errorCode == 0, "Failed to get display bounds (SDLERROR: " + String(SDL_GetError()) + ")");
-        PGE_ASSERT(displayBounds.w > 0 && displayBounds.h > 0, "Display bounds are invalid (" + String::from(displayBounds.w) + "x" + String::from(displayBounds.h) + ")");
+        PGE_ASSERT(displayBounds.w > 0 && displayBounds.h > 0, String::concat("Display bounds are invalid (", String::from(displayBounds.w), "x", String::from(displayBounds.h), ")"));
         SDL_SetWindowSize(getWindow(), displayBounds.w, displayBounds.h);
         SDL_SetWindowPosition(getWindow(), 0, 0);
     }
@@ -107,9 +107,9 @@ void GraphicsDX11::setRenderTargets(const ReferenceVector<Texture>& renderTarget
     }
     for (Reference<Texture> rt : renderTargets) {
         PGE_ASSERT(rt->getWidth() <= maxSizeTexture->getWidth() && rt->getHeight() <= maxSizeTexture->getHeight(),
-            "Render target sizes are incompatible (" +
-            String::from(maxSizeTexture->getWidth()) + "x" + String::from(maxSizeTexture->getHeight()) + " vs " +
-            String::from(rt->getWidth()) + "x" + String::from(rt->getHeight()) + ")");
+            String::concat("Render target sizes are incompatible (",
+                String::from(maxSizeTexture->getWidth()), "x", String::from(maxSizeTexture->getHeight()), " vs ",
+                String::from(rt->getWidth()), "x", String::from(rt->getHeight()), ")"));
     }
     currentDepthStencilView = maxSizeTexture->getZBufferView();
     dxContext->OMSetRenderTargets((UINT)currentRenderTargetViews.size(), currentRenderTargetViews.data(), currentDepthStencilView);
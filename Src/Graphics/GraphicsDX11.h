@@ -63,7 +63,7 @@ class GraphicsDX11 : public GraphicsSpecialized<"DirectX 11", ShaderDX11, MeshDX
 
         D3D11_VIEWPORT dxViewport;
 
-        std::vector<ID3D11RenderTargetView*> currentRenderTargetViews;
+        SmallVector<ID3D11RenderTargetView*, 8> currentRenderTargetViews;
         ID3D11DepthStencilView* currentDepthStencilView;
 
         ResourceManager resourceManager;
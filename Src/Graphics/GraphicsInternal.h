@@ -49,14 +49,6 @@ class GraphicsInternal : public Graphics {
 template <TemplateString RENDERER_NAME, std::derived_from<Shader> SHADER, std::derived_from<Mesh> MESH,
     std::derived_from<Texture> TEXTURE, std::derived_from<Material> MATERIAL = Material, std::derived_from<Texture> RENDER_TEXTURE = TEXTURE>
 class GraphicsSpecialized : public GraphicsInternal {
-    private:
-        static String appendInfoLine(const String& name, int value) {
-            return "\n" + name + ": " + String::from(value);
-        }
-        static String appendInfoLine(const String& name, bool value) {
-            return "\n" + name + ": " + (value ? "true" : "false");
-        }
-
     protected:
         GraphicsSpecialized(const String& name, int w, int h, WindowMode wm, int x, int y, SDL_WindowFlags windowFlags)
             : GraphicsInternal(name, w, h, wm, x, y, windowFlags) { }
@@ -87,14 +79,9 @@ class GraphicsSpecialized : public GraphicsInternal {
         }
 
         String getInfo() const final override {
-            return caption + " (" + RENDERER_NAME + ") "
-                + String::from(dimensions.x) + 'x' + String::from(dimensions.y) + " / "
-                + String::from(viewport.width()) + 'x' + String::from(viewport.height())
-                + appendInfoLine("open", open)
-                + appendInfoLine("focused", focused)
-                + appendInfoLine("windowMode", windowMode == WindowMode::Fullscreen ? "Fullscreen" : "Windowed")
-                + appendInfoLine("vsync enabled", vsync)
-                + appendInfoLine("depth test enabled", depthTest);
+            return String::format<"{} ({}) {}x{} / {}x{}\nopen: {}\nfocused: {}\nwindowMode: {}\nvsync enabled: {}\ndepth test enabled: {}">(
+                caption, RENDERER_NAME, dimensions.x, dimensions.y, viewport.width(), viewport.height(),
+                open, focused, windowMode == WindowMode::Fullscreen ? "Fullscreen" : "Windowed", vsync, depthTest);
         }
 };
 
@@ -27,5 +27,5 @@ int Material::getTextureCount() const {
 
 const Texture& Material::getTexture(int index) const {
     PGE_ASSERT(index >= 0 && index < getTextureCount(), "Texture index out of bounds");
-    return textures.at(index);
+    return textures[index];
 }
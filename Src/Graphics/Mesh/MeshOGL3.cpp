@@ -26,10 +26,10 @@ void MeshOGL3::uploadInternalData() {
     //TODO: determine when we should use GL_DYNAMIC_DRAW
     glBufferData(GL_ARRAY_BUFFER, vertices.getDataSize(), vertices.getData(),GL_STATIC_DRAW);
     glError = glGetError();
-    PGE_ASSERT(glError == GL_NO_ERROR, "Failed to create data store for vertex buffer (GLERROR: " + String::from(glError) + ")");
+    PGE_ASSERT(glError == GL_NO_ERROR, String::concat("Failed to create data store for vertex buffer (GLERROR: ", String::from(glError), ")"));
     glBufferData(GL_ELEMENT_ARRAY_BUFFER,indices.size()*sizeof(GLuint),indices.data(),GL_STATIC_DRAW);
     glError = glGetError();
-    PGE_ASSERT(glError == GL_NO_ERROR, "Failed to create data store for index buffer (GLERROR: " + String::from(glError) + ")");
+    PGE_ASSERT(glError == GL_NO_ERROR, String::concat("Failed to create data store for index buffer (GLERROR: ", String::from(glError), ")"));
 }
 
 static const GLenum glTextureLayers[] = {
@@ -94,7 +94,7 @@ int ShaderDX11::dxgiFormatToByteSize(DXGI_FORMAT dxgiFormat) {
     }
 }
 
-Shader::Constant* ShaderDX11::findConstantInBuffers(std::vector<CBufferInfo>& buffers, const String& name) {
+Shader::Constant* ShaderDX11::findConstantInBuffers(std::vector<CBufferInfo>& buffers, const String::Key& name) {
     for (CBufferInfo& cBuffer : buffers) {
         auto& map = cBuffer.getConstants();
         auto it = map.find(name);
@@ -105,11 +105,11 @@ Shader::Constant* ShaderDX11::findConstantInBuffers(std::vector<CBufferInfo>& bu
     return nullptr;
 }
 
-Shader::Constant* ShaderDX11::getVertexShaderConstant(const String& name) {
+Shader::Constant* ShaderDX11::getVertexShaderConstant(const String::Key& name) {
     return findConstantInBuffers(vertexConstantBuffers, name);
 }
 
-Shader::Constant* ShaderDX11::getFragmentShaderConstant(const String& name) {
+Shader::Constant* ShaderDX11::getFragmentShaderConstant(const String::Key& name) {
     return findConstantInBuffers(fragmentConstantBuffers, name);
 }
 
@@ -179,12 +179,12 @@ byte* ShaderDX11::CBufferInfo::getData() {
     return data;
 }
 
-std::unordered_map<String::Key, ShaderDX11::ConstantDX11>& ShaderDX11::CBufferInfo::getConstants() {
+std::unordered_map<InternedString, ShaderDX11::ConstantDX11>& ShaderDX11::CBufferInfo::getConstants() {
     return constants;
 }
 
 void ShaderDX11::CBufferInfo::addConstant(const String& cName, const ShaderDX11::ConstantDX11& constant) {
-    constants.emplace(cName, constant);
+    constants.emplace(cName.intern(), constant);
 }
 
 bool ShaderDX11::CBufferInfo::isDirty() const {
@@ -10,6 +10,7 @@
 #include <PGE/ResourceManagement/ResourceView.h>
 #include <PGE/File/BinaryReader.h>
 #include <PGE/Graphics/Shader.h>
+#include <PGE/String/InternedString.h>
 
 #include "../../ResourceManagement/DX11.h"
 
@@ -20,8 +21,11 @@ class ShaderDX11 : public Shader {
     public:
         ShaderDX11(const Graphics& gfx, const FilePath& path);
 
-        Constant* getVertexShaderConstant(const String& name) override;
-        Constant* getFragmentShaderConstant(const String& name) override;
+        // The String overloads would be hidden by the overrides otherwise.
+        using Shader::getVertexShaderConstant;
+        using Shader::getFragmentShaderConstant;
+        Constant* getVertexShaderConstant(const String::Key& name) override;
+        Constant* getFragmentShaderConstant(const String::Key& name) override;
 
         void useShader();
         void useVertexInputLayout();
@@ -57,7 +61,7 @@ class ShaderDX11 : public Shader {
                 void operator=(CBufferInfo&& other) noexcept;
 
                 byte* getData();
-                std::unordered_map<String::Key, ConstantDX11>& getConstants();
+                std::unordered_map<InternedString, ConstantDX11>& getConstants();
                 void addConstant(const String& name, const ConstantDX11& constant);
                 bool isDirty() const;
                 void markAsDirty();
@@ -68,12 +72,12 @@ class ShaderDX11 : public Shader {
                 String name;
                 byte* data;
                 int size;
-                std::unordered_map<String::Key, ConstantDX11> constants;
+                std::unordered_map<InternedString, ConstantDX11> constants;
                 ID3D11DeviceContext* dxContext;
                 D3D11Buffer::View dxCBuffer;
                 bool dirty;
         };
-        Constant* findConstantInBuffers(std::vector<CBufferInfo>& asd, const String& name);
+        Constant* findConstantInBuffers(std::vector<CBufferInfo>& asd, const String::Key& name);
 
         std::vector<CBufferInfo> vertexConstantBuffers;
         std::vector<CBufferInfo> fragmentConstantBuffers;
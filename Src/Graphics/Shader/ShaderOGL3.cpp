@@ -1,8 +1,10 @@
 #include "../GraphicsOGL3.h"
 
+#include <PGE/String/StringBuilder.h>
+
 using namespace PGE;
 
-static const String RT_NAME = "_PGE_INTERNAL_YFLIP";
+static constexpr String::Key RT_KEY = "_PGE_INTERNAL_YFLIP"_key;
 
 ShaderOGL3::ShaderOGL3(Graphics& gfx, const FilePath& path) : Shader(path), resourceManager(gfx), graphics((GraphicsOGL3&)gfx) {
     graphics.takeGlContext();
@@ -26,13 +28,13 @@ ShaderOGL3::ShaderOGL3(Graphics& gfx, const FilePath& path) : Shader(path), reso
 
     extractFragmentOutputs(fragmentSource);
 
-    Shader::Constant& rtConstant = *getVertexShaderConstant(RT_NAME);
+    Shader::Constant& rtConstant = *getVertexShaderConstant(RT_KEY);
     rtConstant.setValue(1.f);
     graphics.addRenderTargetFlag(rtConstant);
 }
 
 ShaderOGL3::~ShaderOGL3() {
-    graphics.removeRenderTargetFlag(*getVertexShaderConstant(RT_NAME));
+    graphics.removeRenderTargetFlag(*getVertexShaderConstant(RT_KEY));
 }
 
 void ShaderOGL3::extractVertexUniforms(const String& vertexSource) {
@@ -43,7 +45,7 @@ void ShaderOGL3::extractVertexUniforms(const String& vertexSource) {
         int arrSize = 1; //TODO: add array support
         GLenum glType = parsedTypeToGlType(var.type);
         vertexShaderConstants.emplace(
-            var.name,
+            var.name.intern(),
             ConstantOGL3(
                 graphics,
                 glGetUniformLocation(glShaderProgram, var.name.cstr()),
@@ -78,7 +80,7 @@ void ShaderOGL3::extractVertexAttributes(const String& vertexSource) {
 
         layoutEntries.emplace_back(sanitizedAttrName, glSizeToByteSize(attrElemType, attrElemCount));
         glVertexAttribLocations.emplace(
-            String::Key(sanitizedAttrName),
+            sanitizedAttrName.intern(),
             GlAttribLocation(
                 glGetAttribLocation(glShaderProgram, attrName.cstr()),
                 attrElemType,
@@ -119,9 +121,9 @@ void ShaderOGL3::extractFragmentUniforms(const String& fragmentSource) {
 
         if (var.type.equals("sampler2D")) {
             constant.setValue((u32)samplerConstants.size());
-            samplerConstants.emplace(var.name, constant);
+            samplerConstants.emplace(var.name.intern(), constant);
         } else {
-            fragmentShaderConstants.emplace(var.name, constant);
+            fragmentShaderConstants.emplace(var.name.intern(), constant);
         }
     }
 
@@ -137,40 +139,45 @@ void ShaderOGL3::extractFragmentOutputs(const String& fragmentSource) {
 }
 
 void ShaderOGL3::extractShaderVars(const String& src, const String& varKind, std::vector<ParsedShaderVar>& varList) {
-    String line;
     String varStr = varKind + " ";
-    for (char16 ch : src) {
-        if (ch != '\r' && ch != '\n') {
-            line += ch;
-        } else {
-            int minLen = varStr.length() < line.length() ? varStr.length() : line.length();
-            if (line.substr(0, minLen).equals(varStr)) {
-                bool typeHasBeenRead = false;
-                ParsedShaderVar var;
-                auto it = line.begin() + varStr.length();
-                while (it != line.end()) {
-                    char16 lineCh = *it;
-                    if (lineCh == ' ') {
-                        if (typeHasBeenRead && var.name.length() > 0) {
-                            break;
-                        }
-                        typeHasBeenRead = true;
+    // Lines are viewed in place instead of being copied out of src.
+    const char* chars = src.cstr();
+    int lineStart = 0;
+    for (int i : Range(src.byteLength() + 1)) {
+        if (i < src.byteLength() && chars[i] != '\r' && chars[i] != '\n') {
+            continue;
+        }
+        StringView line(chars + lineStart, i - lineStart);
+        lineStart = i + 1;
+        if (line.byteLength() >= varStr.byteLength() && StringView(line.data(), varStr.byteLength()) == varStr) {
+            bool typeHasBeenRead = false;
+            StringBuilder type;
+            StringBuilder name;
+            auto it = line.begin() + varStr.length();
+            while (it != line.end()) {
+                char16 lineCh = *it;
+                if (lineCh == ' ') {
+                    if (typeHasBeenRead && !name.isEmpty()) {
+                        break;
+                    }
+                    typeHasBeenRead = true;
+                } else {
+                    if (lineCh == ';' || lineCh == '\r' || lineCh == '\n') {
+                        break;
                     } else {
-                        if (lineCh == ';' || lineCh == '\r' || lineCh == '\n') {
-                            break;
+                        if (typeHasBeenRead) {
+                            name.append(lineCh);
                         } else {
-                            if (typeHasBeenRead) {
-                                var.name += lineCh;
-                            } else {
-                                var.type += lineCh;
-                            }
+                            type.append(lineCh);
                         }
                     }
-                    it++;
                 }
-                varList.emplace_back(var);
+                it++;
             }
-            line = String();
+            ParsedShaderVar var;
+            var.type = type.build();
+            var.name = name.build();
+            varList.emplace_back(var);
         }
     }
 }
@@ -200,7 +207,7 @@ int ShaderOGL3::glSizeToByteSize(GLenum type, int size) const {
             retVal *= sizeof(GLfloat) * 4 * 4;
         } break;
         default: {
-            throw Exception("Unsupported OpenGL datatype: " + String::from(type));
+            throw Exception(String::concat("Unsupported OpenGL datatype: ", String::from(type)));
         } break;
     }
     return retVal;
@@ -252,7 +259,7 @@ void ShaderOGL3::decomposeGlType(GLenum compositeType, GLenum& elemType, int& el
             elemType = GL_FLOAT; elemCount = 4 * 4;
         } break;
         default: {
-            throw Exception("Unsupported OpenGL datatype: " + String::from(compositeType));
+            throw Exception(String::concat("Unsupported OpenGL datatype: ", String::from(compositeType)));
         }
     }
 }
@@ -271,7 +278,7 @@ void ShaderOGL3::useShader() {
         glEnableVertexAttribArray(glAttribLocation.location);
         glVertexAttribPointer(glAttribLocation.location, glAttribLocation.elementCount, glAttribLocation.elementType, GL_FALSE, vertexLayout.getElementSize(), ptr + locationAndSizeInBuffer.location);
         glError = glGetError();
-        PGE_ASSERT(glError == GL_NO_ERROR, "Failed to set vertex attribute (filepath: " + filepath.str() + "; attrib: " + String::hexFromInt(key.hash) + ")");
+        PGE_ASSERT(glError == GL_NO_ERROR, String::concat("Failed to set vertex attribute (filepath: ", filepath.str(), "; attrib: ", key.str(), ")"));
     }
 
     for (auto& [_, constant] : vertexShaderConstants) {
@@ -295,13 +302,13 @@ void ShaderOGL3::unbindGLAttribs() {
     }
 }
 
-Shader::Constant* ShaderOGL3::getVertexShaderConstant(const String& name) {
+Shader::Constant* ShaderOGL3::getVertexShaderConstant(const String::Key& name) {
     auto it = vertexShaderConstants.find(name);
     if (it == vertexShaderConstants.end()) { return nullptr; }
     return &it->second;
 }
 
-Shader::Constant* ShaderOGL3::getFragmentShaderConstant(const String& name) {
+Shader::Constant* ShaderOGL3::getFragmentShaderConstant(const String::Key& name) {
     auto it = fragmentShaderConstants.find(name);
     if (it == fragmentShaderConstants.end()) { return nullptr; }
     return &it->second;
@@ -345,7 +352,7 @@ void ShaderOGL3::ConstantOGL3::setUniform() {
     }
 
     GLuint glError = glGetError();
-    PGE_ASSERT(glError == GL_NO_ERROR, "Failed to set uniform value (GLERROR: " + String::from(glError) +")");
+    PGE_ASSERT(glError == GL_NO_ERROR, String::concat("Failed to set uniform value (GLERROR: ", String::from(glError), ")"));
 }
 
 ShaderOGL3::GlAttribLocation::GlAttribLocation(GLint loc, GLenum elemType, int elemCount) {
@@ -5,7 +5,9 @@
 #include <PGE/Graphics/Shader.h>
 #include <PGE/String/String.h>
 #include <PGE/String/Key.h>
+#include <PGE/String/InternedString.h>
 #include <PGE/Math/Matrix.h>
+#include <PGE/Types/FlatHashMap.h>
 
 #include "../../ResourceManagement/OGL3.h"
 #include "../../ResourceManagement/ResourceManagerOGL3.h"
@@ -18,8 +20,11 @@ class ShaderOGL3 : public Shader {
         ShaderOGL3(Graphics& gfx, const FilePath& path);
         ~ShaderOGL3();
 
-        Constant* getVertexShaderConstant(const String& name) override;
-        Constant* getFragmentShaderConstant(const String& name) override;
+        // The String overloads would be hidden by the overrides otherwise.
+        using Shader::getVertexShaderConstant;
+        using Shader::getFragmentShaderConstant;
+        Constant* getVertexShaderConstant(const String::Key& name) override;
+        Constant* getFragmentShaderConstant(const String::Key& name) override;
 
         void useShader();
         void unbindGLAttribs();
@@ -46,9 +51,9 @@ class ShaderOGL3 : public Shader {
                 void setValueInternal(const std::span<byte>& value) override;
         };
 
-        std::unordered_map<String::Key, ConstantOGL3> vertexShaderConstants;
-        std::unordered_map<String::Key, ConstantOGL3> fragmentShaderConstants;
-        std::unordered_map<String::Key, ConstantOGL3> samplerConstants;
+        FlatHashMap<InternedString, ConstantOGL3> vertexShaderConstants;
+        FlatHashMap<InternedString, ConstantOGL3> fragmentShaderConstants;
+        FlatHashMap<InternedString, ConstantOGL3> samplerConstants;
 
         struct GlAttribLocation {
             GlAttribLocation(GLint loc, GLenum elemType, int elemCount);
@@ -58,7 +63,7 @@ class ShaderOGL3 : public Shader {
             int elementCount;
         };
 
-        std::unordered_map<String::Key, GlAttribLocation> glVertexAttribLocations;
+        FlatHashMap<InternedString, GlAttribLocation> glVertexAttribLocations;
 
         std::unique_ptr<byte[]> vertexUniformData;
         std::unique_ptr<byte[]> fragmentUniformData;
@@ -22,7 +22,7 @@ static void assertSDL(int retCode, const std::source_location& location = std::s
 static void showError(const String& exceptionType, const String& what) {
     TextWriter writer = TextWriter(FilePath::fromStr("exception.txt"));
     writer.writeLine(Info::REPO_LINK);
-    writer.writeLine(Info::BRANCH + " - " + Info::COMMIT);
+    writer.writeLine(String::concat(Info::BRANCH, " - ", Info::COMMIT));
     writer.writeLine(exceptionType);
     writer.writeLine(what);
     SDL_ShowSimpleMessageBox(SDL_MessageBoxFlags::SDL_MESSAGEBOX_ERROR, "Fatal Error",
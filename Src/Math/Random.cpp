@@ -143,7 +143,7 @@ namespace PGE {
 
     // [min, max)
     i32 Random::nextInt(i32 min, i32 max) {
-        PGE_ASSERT(min <= max, "min > max (min: " + String::from(min) + ", max: " + String::from(max) + ")");
+        PGE_ASSERT(min <= max, String::concat("min > max (min: ", String::from(min), ", max: ", String::from(max), ")"));
         return nextInt(max - min) + min;
     }
 
@@ -3,38 +3,31 @@
 #include <PGE/Math/Vector.h>
 #include <PGE/Math/Matrix.h>
 
-using namespace PGE;
+#include <utility>
 
-template <typename T, auto T::*first, auto T::*... args>
-static String concat(const T& t) {
-	return "(" + String::from(t.*first) +  ((", " + String::from(t.*args)) + ...) + ")";
-}
+using namespace PGE;
 
 template <> String String::from(const Vector2f& vec) {
-	return concat<Vector2f, &Vector2f::x, &Vector2f::y>(vec);
+	return format<"({}, {})">(vec.x, vec.y);
 }
 
 template <> String String::from(const Vector3f& vec) {
-	return concat<Vector3f, &Vector3f::x, &Vector3f::y, &Vector3f::z>(vec);
+	return format<"({}, {}, {})">(vec.x, vec.y, vec.z);
 }
 
 template <> String String::from(const Vector4f& vec) {
-	return concat<Vector4f, &Vector4f::x, &Vector4f::y, &Vector4f::z, &Vector4f::w>(vec);
+	return format<"({}, {}, {}, {})">(vec.x, vec.y, vec.z, vec.w);
 }
 
 template <> String String::from(const Vector2i& vec) {
-	return concat<Vector2i, &Vector2i::x, &Vector2i::y>(vec);
+	return format<"({}, {})">(vec.x, vec.y);
+}
+
+template <size_t... I>
+static String formatRows(const Matrix4x4f& mat, std::index_sequence<I...>) {
+	return String::format<"\n({}, {}, {}, {})\n({}, {}, {}, {})\n({}, {}, {}, {})\n({}, {}, {}, {})\n">(mat[(int)I / 4][I % 4]...);
 }
 
 template <> String String::from(const Matrix4x4f& mat) {
-	String ret{'\n'};
-	for (int i : Range(4)) {
-		ret += "(";
-		for (int j : Range(4)) {
-			if (j != 0) { ret += ", "; }
-			ret += String::from(mat[i][j]);
-		}
-		ret += ")\n";
-	}
-	return ret;
+	return formatRows(mat, std::make_index_sequence<16>());
 }
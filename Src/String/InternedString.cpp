@@ -0,0 +1,64 @@
+#include <PGE/String/InternedString.h>
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+using namespace PGE;
+
+// Sharded by the top bits of the hash, so threads interning different strings rarely contend.
+// Nodes of unordered containers never move and nothing is ever erased, which lets entries be handed out by pointer.
+struct InternedString::Table {
+    static constexpr int SHARD_BITS = 4;
+
+    struct EntryHash {
+        size_t operator()(const Entry& entry) const {
+            return (size_t)entry.hash;
+        }
+    };
+
+    struct EntryEqual {
+        bool operator()(const Entry& a, const Entry& b) const {
+            return a.hash == b.hash && a.str == b.str;
+        }
+    };
+
+    struct Shard {
+        std::shared_mutex mutex;
+        std::unordered_set<Entry, EntryHash, EntryEqual> entries;
+    };
+
+    Shard shards[1 << SHARD_BITS];
+
+    static Table& get() {
+        static Table table;
+        return table;
+    }
+
+    const Entry* intern(const String& str) {
+        Entry lookup = { str, str.getHashCode() };
+        Shard& shard = shards[lookup.hash >> (64 - SHARD_BITS)];
+        {
+            std::shared_lock lock(shard.mutex);
+            auto it = shard.entries.find(lookup);
+            if (it != shard.entries.end()) {
+                return &*it;
+            }
+        }
+        std::unique_lock lock(shard.mutex);
+        // Another thread may have inserted it in the meantime, in which case that entry is returned.
+        return &*shard.entries.insert(std::move(lookup)).first;
+    }
+};
+
+InternedString::InternedString() {
+    static const Entry* empty = Table::get().intern(String());
+    entry = empty;
+}
+
+InternedString::InternedString(const String& str)
+    : entry(Table::get().intern(str)) { }
+
+InternedString String::intern() const {
+    return InternedString(*this);
+}
@@ -0,0 +1,352 @@
+#include "NumberHelper.h"
+
+#include "PowersOfFive.h"
+
+#include <cmath>
+#include <charconv>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+using namespace PGE;
+
+//
+// Formatting
+//
+
+template <std::floating_point F>
+static int formatShortest(F f, char* buf) {
+    if (std::isnan(f)) {
+        memcpy(buf, "NaN", 3);
+        return 3;
+    }
+    if (std::isinf(f)) {
+        int size = f < 0 ? 9 : 8;
+        memcpy(buf, f < 0 ? "-Infinity" : "Infinity", size);
+        return size;
+    }
+    // Without a format, to_chars picks the shortest digits that round trip and the shorter of fixed and scientific notation.
+    std::to_chars_result result = std::to_chars(buf, buf + Numbers::MAX_FLOAT_LENGTH, f);
+    return (int)(result.ptr - buf);
+}
+
+int Numbers::formatFloat(float f, char* buf) { return formatShortest(f, buf); }
+int Numbers::formatFloat(double f, char* buf) { return formatShortest(f, buf); }
+int Numbers::formatFloat(long double f, char* buf) { return formatShortest(f, buf); }
+
+//
+// Parsing
+//
+
+// Properties of the binary formats that Eisel-Lemire depends on.
+template <typename F>
+struct FloatFormat;
+
+template <>
+struct FloatFormat<float> {
+    using Bits = u32;
+    static constexpr int MANTISSA_BITS = 23;
+    static constexpr int MIN_EXPONENT = -127;
+    static constexpr int INFINITE_POWER = 0xFF;
+    // Anything times 10 to a smaller power rounds to zero, anything not zero times 10 to a larger power is infinite.
+    static constexpr int SMALLEST_POWER_OF_TEN = -64;
+    static constexpr int LARGEST_POWER_OF_TEN = 38;
+    // Only in this range can the product be exactly between two floats.
+    static constexpr int MIN_ROUND_TO_EVEN_EXPONENT = -17;
+    static constexpr int MAX_ROUND_TO_EVEN_EXPONENT = 10;
+    // Both the mantissa and the power of ten are exact floats, so a single multiplication or division rounds correctly.
+    static constexpr u64 MAX_EXACT_MANTISSA = 1ull << 24;
+    static constexpr int MAX_EXACT_POWER_OF_TEN = 10;
+};
+
+template <>
+struct FloatFormat<double> {
+    using Bits = u64;
+    static constexpr int MANTISSA_BITS = 52;
+    static constexpr int MIN_EXPONENT = -1023;
+    static constexpr int INFINITE_POWER = 0x7FF;
+    static constexpr int SMALLEST_POWER_OF_TEN = -342;
+    static constexpr int LARGEST_POWER_OF_TEN = 308;
+    static constexpr int MIN_ROUND_TO_EVEN_EXPONENT = -4;
+    static constexpr int MAX_ROUND_TO_EVEN_EXPONENT = 23;
+    static constexpr u64 MAX_EXACT_MANTISSA = 1ull << 53;
+    static constexpr int MAX_EXACT_POWER_OF_TEN = 22;
+};
+
+static constexpr double EXACT_POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// Longer mantissas don't fit into 64 bits.
+static constexpr int MAX_MANTISSA_DIGITS = 19;
+
+// A parsed number, mantissa * 10^exponent.
+struct Decimal {
+    u64 mantissa = 0;
+    i64 exponent = 0;
+    // Without leading zeroes once there are more than MAX_MANTISSA_DIGITS.
+    i64 digitCount = 0;
+    bool negative = false;
+    // There were more than MAX_MANTISSA_DIGITS significant digits, the mantissa is meaningless.
+    bool truncated = false;
+};
+
+static bool isDigit(char ch) {
+    return ch >= '0' && ch <= '9';
+}
+
+// Appends all digits at str to mantissa, wrapping around if there are too many of them.
+static const char* parseDigits(const char* str, const char* end, u64& mantissa) {
+    while (end - str >= 8) {
+        u64 chunk = Numbers::readEightBytes(str);
+        if (!Numbers::isEightDigits(chunk)) { break; }
+        mantissa = mantissa * 100'000'000 + Numbers::parseEightDigits(chunk);
+        str += 8;
+    }
+    for (; str != end && isDigit(*str); str++) {
+        mantissa = mantissa * 10 + (*str - '0');
+    }
+    return str;
+}
+
+static bool parseDecimal(const char* str, const char* end, Decimal& decimal) {
+    const char* digitsStart = str;
+    const char* cur = parseDigits(str, end, decimal.mantissa);
+    i64& digitCount = decimal.digitCount;
+    digitCount = cur - digitsStart;
+    if (cur != end && *cur == '.') {
+        cur++;
+        const char* fractionStart = cur;
+        cur = parseDigits(cur, end, decimal.mantissa);
+        decimal.exponent = -(cur - fractionStart);
+        digitCount += cur - fractionStart;
+    }
+    if (digitCount == 0) { return false; }
+
+    if (cur != end && (*cur == 'e' || *cur == 'E')) {
+        cur++;
+        bool exponentNegative = false;
+        if (cur != end && (*cur == '-' || *cur == '+')) {
+            exponentNegative = *cur == '-';
+            cur++;
+        }
+        if (cur == end || !isDigit(*cur)) { return false; }
+        i64 exponent = 0;
+        for (; cur != end && isDigit(*cur); cur++) {
+            // Way beyond infinity and zero already, but the digits still have to be consumed.
+            if (exponent < 0x10000) {
+                exponent = exponent * 10 + (*cur - '0');
+            }
+        }
+        decimal.exponent += exponentNegative ? -exponent : exponent;
+    }
+    if (cur != end) { return false; }
+
+    if (digitCount > MAX_MANTISSA_DIGITS) {
+        // Leading zeroes don't affect the mantissa.
+        for (const char* it = digitsStart; it != end && (*it == '0' || *it == '.'); it++) {
+            if (*it == '0') { digitCount--; }
+        }
+        decimal.truncated = digitCount > MAX_MANTISSA_DIGITS;
+    }
+    return true;
+}
+
+struct Product {
+    u64 high;
+    u64 low;
+};
+
+static Product multiply(u64 a, u64 b) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = (unsigned __int128)a * b;
+    return { (u64)(product >> 64), (u64)product };
+#elif defined(_MSC_VER) && defined(_M_X64)
+    u64 high;
+    u64 low = _umul128(a, b, &high);
+    return { high, low };
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+    return { __umulh(a, b), a * b };
+#else
+    u64 aLow = (u32)a; u64 aHigh = a >> 32;
+    u64 bLow = (u32)b; u64 bHigh = b >> 32;
+    u64 lowLow = aLow * bLow;
+    u64 lowHigh = aLow * bHigh;
+    u64 highLow = aHigh * bLow;
+    u64 middle = (lowLow >> 32) + (u32)lowHigh + (u32)highLow;
+    return { aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32), (middle << 32) | (u32)lowLow };
+#endif
+}
+
+// floor(log2(10^q)) + 63, exact for the range of the table.
+static int binaryExponent(int q) {
+    return (((152170 + 65536) * q) >> 16) + 63;
+}
+
+// Eisel-Lemire: the top bits of w * 5^q decide the binary mantissa, the power of 2 is known from q alone.
+// @returns false if the truncated product of the table is not precise enough to decide the rounding.
+template <typename F>
+static bool eiselLemire(i64 q, u64 w, typename FloatFormat<F>::Bits& bits) {
+    using Format = FloatFormat<F>;
+    using Bits = typename Format::Bits;
+    if (w == 0 || q < Format::SMALLEST_POWER_OF_TEN) {
+        bits = 0;
+        return true;
+    }
+    if (q > Format::LARGEST_POWER_OF_TEN) {
+        bits = (Bits)Format::INFINITE_POWER << Format::MANTISSA_BITS;
+        return true;
+    }
+
+    int leadingZeroes = std::countl_zero(w);
+    w <<= leadingZeroes;
+
+    // One more bit than the mantissa needs to round, one to detect the position of the highest bit and one to detect halfway cases.
+    constexpr int PRECISION = Format::MANTISSA_BITS + 3;
+    constexpr u64 PRECISION_MASK = ~0ull >> PRECISION;
+    int index = 2 * (int)(q - Numbers::SMALLEST_POWER_OF_FIVE);
+    Product product = multiply(w, Numbers::POWERS_OF_FIVE[index]);
+    // The bits below the precision are all ones, so the truncated low half of the power might still carry into them.
+    if ((product.high & PRECISION_MASK) == PRECISION_MASK) {
+        Product lower = multiply(w, Numbers::POWERS_OF_FIVE[index + 1]);
+        product.low += lower.high;
+        if (lower.high > product.low) { product.high++; }
+        // Powers of five in [-27, 55] are exact in the table, for everything else the error can't be ruled out.
+        if (product.low == ~0ull && (q < -27 || q > 55)) { return false; }
+    }
+
+    int upperBit = (int)(product.high >> 63);
+    int shift = upperBit + 64 - Format::MANTISSA_BITS - 3;
+    u64 mantissa = product.high >> shift;
+    int power2 = binaryExponent((int)q) + upperBit - leadingZeroes - Format::MIN_EXPONENT;
+
+    if (power2 <= 0) {
+        // Subnormal, shifted into place and rounded.
+        if (-power2 + 1 >= 64) {
+            bits = 0;
+            return true;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        // Rounding up might have made it normal after all.
+        power2 = mantissa < (1ull << Format::MANTISSA_BITS) ? 0 : 1;
+        bits = (Bits)((mantissa & ((1ull << Format::MANTISSA_BITS) - 1)) | ((u64)power2 << Format::MANTISSA_BITS));
+        return true;
+    }
+
+    // Exactly halfway between two floats, which rounds to the even one instead of up.
+    if (product.low <= 1 && q >= Format::MIN_ROUND_TO_EVEN_EXPONENT && q <= Format::MAX_ROUND_TO_EVEN_EXPONENT
+        && (mantissa & 3) == 1 && (mantissa << shift) == product.high) {
+        mantissa &= ~1ull;
+    }
+
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (2ull << Format::MANTISSA_BITS)) {
+        mantissa = 1ull << Format::MANTISSA_BITS;
+        power2++;
+    }
+    mantissa &= ~(1ull << Format::MANTISSA_BITS);
+    if (power2 >= Format::INFINITE_POWER) {
+        power2 = Format::INFINITE_POWER;
+        mantissa = 0;
+    }
+    bits = (Bits)(mantissa | ((u64)power2 << Format::MANTISSA_BITS));
+    return true;
+}
+
+template <typename F>
+static bool decimalToFloat(const Decimal& decimal, F& out) {
+    using Format = FloatFormat<F>;
+    if (decimal.truncated) { return false; }
+
+    if (decimal.exponent >= -Format::MAX_EXACT_POWER_OF_TEN && decimal.exponent <= Format::MAX_EXACT_POWER_OF_TEN
+        && decimal.mantissa <= Format::MAX_EXACT_MANTISSA) {
+        F value = (F)decimal.mantissa;
+        if (decimal.exponent < 0) {
+            value /= (F)EXACT_POWERS_OF_TEN[-decimal.exponent];
+        } else {
+            value *= (F)EXACT_POWERS_OF_TEN[decimal.exponent];
+        }
+        out = decimal.negative ? -value : value;
+        return true;
+    }
+
+    typename Format::Bits bits;
+    if (!eiselLemire<F>(decimal.exponent, decimal.mantissa, bits)) { return false; }
+    F value = std::bit_cast<F>(bits);
+    out = decimal.negative ? -value : value;
+    return true;
+}
+
+// Only reached for more than MAX_MANTISSA_DIGITS significant digits or undecidable Eisel-Lemire products.
+template <std::floating_point F>
+static bool parseExactly(const char* str, const char* end, const Decimal& decimal, F& out) {
+    F value;
+    std::from_chars_result result = std::from_chars(str, end, value, std::chars_format::general);
+    if (result.ptr != end) { return false; }
+    if (result.ec == std::errc::result_out_of_range) {
+        // Either at least 1 and too large or below 1 and too small.
+        value = decimal.exponent + decimal.digitCount > 0 ? std::numeric_limits<F>::infinity() : (F)0;
+    } else if (result.ec != std::errc()) {
+        return false;
+    }
+    out = decimal.negative ? -value : value;
+    return true;
+}
+
+// Whether [str, end) is equal to the lowercase ASCII word, ignoring case.
+static bool equalsWordIgnoreCase(const char* str, const char* end, const char* word) {
+    for (; *word != '\0'; str++, word++) {
+        if (str == end || (*str | 0x20) != *word) { return false; }
+    }
+    return str == end;
+}
+
+template <std::floating_point F>
+static bool parseSpecial(const char* str, const char* end, bool negative, F& out) {
+    if (equalsWordIgnoreCase(str, end, "nan")) {
+        out = std::numeric_limits<F>::quiet_NaN();
+        return true;
+    }
+    if (equalsWordIgnoreCase(str, end, "inf") || equalsWordIgnoreCase(str, end, "infinity")
+        || (end - str == 3 && memcmp(str, "\xE2\x88\x9E", 3) == 0)) {
+        out = negative ? -std::numeric_limits<F>::infinity() : std::numeric_limits<F>::infinity();
+        return true;
+    }
+    return false;
+}
+
+template <std::floating_point F>
+static bool parse(const char* str, int length, F& out) {
+    const char* end = str + length;
+    Decimal decimal;
+    if (str != end && (*str == '-' || *str == '+')) {
+        decimal.negative = *str == '-';
+        str++;
+    }
+    // Words are only looked at once it's clear that this isn't a plain number.
+    if (str != end && !isDigit(*str) && *str != '.') {
+        return parseSpecial(str, end, decimal.negative, out);
+    }
+    if (!parseDecimal(str, end, decimal)) { return false; }
+
+    if constexpr (std::numeric_limits<F>::digits == std::numeric_limits<double>::digits) {
+        double value;
+        if (decimalToFloat(decimal, value)) {
+            out = (F)value;
+            return true;
+        }
+    } else if constexpr (std::is_same<F, float>::value) {
+        if (decimalToFloat(decimal, out)) { return true; }
+    }
+    // Extended precision long doubles always end up here.
+    return parseExactly(str, end, decimal, out);
+}
+
+bool Numbers::parseFloat(const char* str, int length, float& out) { return parse(str, length, out); }
+bool Numbers::parseFloat(const char* str, int length, double& out) { return parse(str, length, out); }
+bool Numbers::parseFloat(const char* str, int length, long double& out) { return parse(str, length, out); }
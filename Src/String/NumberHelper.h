@@ -0,0 +1,107 @@
+#ifndef PGE_INTERNAL_NUMBERHELPER_H_INCLUDED
+#define PGE_INTERNAL_NUMBERHELPER_H_INCLUDED
+
+#include <bit>
+#include <limits>
+#include <cstring>
+#include <concepts>
+
+#include <PGE/Types/Types.h>
+
+namespace PGE {
+
+/// Locale independent conversions between numbers and text, working on contiguous bytes instead of codepoints.
+/// Parsing only succeeds if the number makes up all of the given bytes.
+namespace Numbers {
+    /// Room for everything #formatFloat writes.
+    constexpr int MAX_FLOAT_LENGTH = 64;
+
+    /// Writes the shortest representation that parses back to exactly f.
+    /// Non-finite values are written as "NaN", "Infinity" and "-Infinity".
+    /// @returns The number of bytes written.
+    int formatFloat(float f, char* buf);
+    int formatFloat(double f, char* buf);
+    int formatFloat(long double f, char* buf);
+
+    /// Parses an optional sign, digits with an optional decimal point and an optional exponent, rounding to the nearest value.
+    /// "NaN", "Inf", "Infinity" and "\u221E" are accepted regardless of case.
+    bool parseFloat(const char* str, int length, float& out);
+    bool parseFloat(const char* str, int length, double& out);
+    bool parseFloat(const char* str, int length, long double& out);
+
+    /// Reads 8 bytes as a little-endian integer, the first byte ends up in the lowest bits.
+    inline u64 readEightBytes(const char* buf) {
+        u64 chunk;
+        memcpy(&chunk, buf, sizeof(chunk));
+        if constexpr (std::endian::native == std::endian::big) {
+            chunk = std::byteswap(chunk);
+        }
+        return chunk;
+    }
+
+    /// Whether all bytes of a chunk read via #readEightBytes are ASCII digits.
+    inline bool isEightDigits(u64 chunk) {
+        // Digits are 0x30 to 0x39, adding 6 keeps exactly those below 0x40.
+        return ((chunk & 0xF0F0F0F0F0F0F0F0u) | (((chunk + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u) >> 4)) == 0x3333333333333333u;
+    }
+
+    /// Value of a chunk of 8 ASCII digits, combining neighbouring digits in parallel instead of one at a time.
+    inline u32 parseEightDigits(u64 chunk) {
+        constexpr u64 MASK = 0x000000FF000000FFu;
+        chunk -= 0x3030303030303030u;
+        // Every byte now holds the value of itself and the digit before it.
+        chunk = chunk * 10 + (chunk >> 8);
+        // Two multiplications merge those into groups of four digits and both groups into the upper half.
+        chunk = ((chunk & MASK) * (100 + (1000000ull << 32)) + ((chunk >> 16) & MASK) * (1 + (10000ull << 32))) >> 32;
+        return (u32)chunk;
+    }
+
+    /// Value of an ASCII digit or letter, 36 for anything else.
+    inline int digitValue(char ch) {
+        if (ch >= '0' && ch <= '9') { return ch - '0'; }
+        if (ch >= 'a' && ch <= 'z') { return ch - 'a' + 10; }
+        if (ch >= 'A' && ch <= 'Z') { return ch - 'A' + 10; }
+        return 36;
+    }
+
+    /// Parses the digits of a number in BASE, preceded by an optional sign for signed types.
+    /// Fails if there are no digits or the value doesn't fit into I.
+    template <std::integral I, int BASE>
+    bool parseInteger(const char* str, int length, I& out) {
+        static_assert(sizeof(I) <= sizeof(u64));
+        const char* end = str + length;
+        bool negative = false;
+        if constexpr (std::numeric_limits<I>::is_signed) {
+            if (str != end && (*str == '-' || *str == '+')) {
+                negative = *str == '-';
+                str++;
+            }
+        }
+        if (str == end) { return false; }
+
+        // The magnitude of the minimum of signed types is one larger than the maximum.
+        u64 limit = (u64)std::numeric_limits<I>::max() + (negative ? 1 : 0);
+        u64 value = 0;
+        if constexpr (BASE == 10) {
+            // Whole chunks of digits while they can't overflow, the last ones are checked one by one.
+            while (end - str >= 8 && limit >= 99'999'999 && value <= (limit - 99'999'999) / 100'000'000) {
+                u64 chunk = readEightBytes(str);
+                if (!isEightDigits(chunk)) { break; }
+                value = value * 100'000'000 + parseEightDigits(chunk);
+                str += 8;
+            }
+        }
+        for (; str != end; str++) {
+            int digit = digitValue(*str);
+            if (digit >= BASE) { return false; }
+            if (value > (limit - digit) / BASE) { return false; }
+            value = value * BASE + digit;
+        }
+        out = negative ? (I)(0 - value) : (I)value;
+        return true;
+    }
+}
+
+}
+
+#endif // PGE_INTERNAL_NUMBERHELPER_H_INCLUDED
@@ -0,0 +1,822 @@
+#include <PGE/String/Regex.h>
+
+#include <span>
+#include <algorithm>
+#include <unordered_map>
+
+#include <PGE/String/StringBuilder.h>
+#include <PGE/Exception/Exception.h>
+#include <PGE/Math/Hasher.h>
+
+#include "UnicodeHelper.h"
+#include "NumberHelper.h"
+
+using namespace PGE;
+
+//
+// Parsing
+//
+
+struct Regex::Node {
+    enum class Type {
+        EMPTY,
+        // A single codepoint out of ranges.
+        CHARS,
+        CONCAT,
+        ALTERNATE,
+        REPEAT,
+        BEGIN,
+        END,
+    };
+
+    // Inclusive codepoint ranges.
+    using Ranges = std::vector<std::pair<u32, u32>>;
+
+    Type type = Type::EMPTY;
+    Ranges ranges;
+    std::vector<Node> children;
+    // Repetitions of the only child, max is negative if unbounded.
+    int min = 0;
+    int max = 0;
+    bool greedy = true;
+};
+
+struct Regex::Parser {
+    static constexpr u32 MAX_CODEPOINT = 0x10FFFF;
+    static constexpr int MAX_REPEAT = 1000;
+
+    const StringView& pattern;
+    std::vector<u32> chars;
+    int pos = 0;
+
+    Parser(const StringView& pattern) : pattern(pattern) {
+        const char* buf = pattern.data();
+        for (int i = 0; i < pattern.byteLength();) {
+            int len = Unicode::measureCodepoint(buf[i]);
+            u32 ch = len == 1 ? (byte)buf[i] : (byte)buf[i] & (0x7F >> len);
+            for (int j = 1; j < len; j++) {
+                ch = (ch << 6) | ((byte)buf[i + j] & 0x3F);
+            }
+            chars.push_back(ch);
+            i += len;
+        }
+    }
+
+    Node parse() {
+        Node ret = parseAlternation();
+        check(atEnd(), "Unmatched ')'");
+        return ret;
+    }
+
+    void check(bool cond, const StringView& problem) const {
+        PGE_ASSERT(cond, String::concat("Invalid regex \"", pattern, "\": ", problem));
+    }
+
+    bool atEnd() const {
+        return pos == (int)chars.size();
+    }
+
+    bool peek(u32 ch) const {
+        return !atEnd() && chars[pos] == ch;
+    }
+
+    bool consume(u32 ch) {
+        if (peek(ch)) {
+            pos++;
+            return true;
+        }
+        return false;
+    }
+
+    Node parseAlternation() {
+        Node first = parseConcatenation();
+        if (!peek('|')) {
+            return first;
+        }
+        Node ret;
+        ret.type = Node::Type::ALTERNATE;
+        ret.children.push_back(std::move(first));
+        while (consume('|')) {
+            ret.children.push_back(parseConcatenation());
+        }
+        return ret;
+    }
+
+    Node parseConcatenation() {
+        Node ret;
+        ret.type = Node::Type::CONCAT;
+        while (!atEnd() && !peek('|') && !peek(')')) {
+            ret.children.push_back(parseRepetition());
+        }
+        return ret;
+    }
+
+    Node parseRepetition() {
+        Node atom = parseAtom();
+        int min;
+        int max;
+        if (!parseQuantifier(min, max)) {
+            return atom;
+        }
+        check(atom.type != Node::Type::BEGIN && atom.type != Node::Type::END, "Nothing to repeat");
+        Node ret;
+        ret.type = Node::Type::REPEAT;
+        ret.min = min;
+        ret.max = max;
+        ret.greedy = !consume('?');
+        ret.children.push_back(std::move(atom));
+        return ret;
+    }
+
+    // A '{' that doesn't start a valid quantifier is a literal.
+    bool parseQuantifier(int& min, int& max) {
+        if (consume('*')) { min = 0; max = -1; return true; }
+        if (consume('+')) { min = 1; max = -1; return true; }
+        if (consume('?')) { min = 0; max = 1; return true; }
+        if (!peek('{')) {
+            return false;
+        }
+        int start = pos++;
+        if (parseNumber(min)) {
+            max = min;
+            if (consume(',') && !parseNumber(max)) {
+                max = -1;
+            }
+            if (consume('}')) {
+                check(max < 0 || min <= max, "Quantifier range out of order");
+                return true;
+            }
+        }
+        pos = start;
+        return false;
+    }
+
+    bool parseNumber(int& out) {
+        int start = pos;
+        out = 0;
+        while (!atEnd() && chars[pos] >= '0' && chars[pos] <= '9') {
+            out = out * 10 + (int)(chars[pos] - '0');
+            check(out <= MAX_REPEAT, "Repetition count too large");
+            pos++;
+        }
+        return pos != start;
+    }
+
+    Node parseAtom() {
+        int min;
+        int max;
+        check(!parseQuantifier(min, max), "Nothing to repeat");
+
+        Node ret;
+        u32 ch = chars[pos++];
+        switch (ch) {
+            case '(': {
+                if (consume('?')) {
+                    check(consume(':'), "Lookarounds are not supported");
+                }
+                ret = parseAlternation();
+                check(consume(')'), "Missing ')'");
+            } break;
+            case '^': {
+                ret.type = Node::Type::BEGIN;
+            } break;
+            case '$': {
+                ret.type = Node::Type::END;
+            } break;
+            case '[': {
+                ret.type = Node::Type::CHARS;
+                ret.ranges = parseClass();
+            } break;
+            case '.': {
+                // Everything but line terminators.
+                ret.type = Node::Type::CHARS;
+                ret.ranges = negate({ { '\n', '\n' }, { '\r', '\r' }, { 0x2028, 0x2029 } });
+            } break;
+            case '\\': {
+                ret.type = Node::Type::CHARS;
+                ret.ranges = parseEscape(false);
+            } break;
+            default: {
+                ret.type = Node::Type::CHARS;
+                ret.ranges = { { ch, ch } };
+            } break;
+        }
+        return ret;
+    }
+
+    Node::Ranges parseClass() {
+        bool negated = consume('^');
+        Node::Ranges ret;
+        while (true) {
+            check(!atEnd(), "Missing ']'");
+            if (consume(']')) {
+                break;
+            }
+            Node::Ranges from = parseClassAtom();
+            if (peek('-') && pos + 1 < (int)chars.size() && chars[pos + 1] != ']') {
+                pos++;
+                Node::Ranges to = parseClassAtom();
+                if (isSingle(from) && isSingle(to)) {
+                    check(from[0].first <= to[0].first, "Class range out of order");
+                    ret.emplace_back(from[0].first, to[0].first);
+                    continue;
+                }
+                // Like in browsers, the '-' is a literal if either side is a class escape.
+                from.emplace_back('-', '-');
+                from.insert(from.end(), to.begin(), to.end());
+            }
+            ret.insert(ret.end(), from.begin(), from.end());
+        }
+        return negated ? negate(ret) : normalize(ret);
+    }
+
+    Node::Ranges parseClassAtom() {
+        u32 ch = chars[pos++];
+        if (ch == '\\') {
+            return parseEscape(true);
+        }
+        return { { ch, ch } };
+    }
+
+    Node::Ranges parseEscape(bool inClass) {
+        static const Node::Ranges DIGITS = { { '0', '9' } };
+        static const Node::Ranges WORD = { { '0', '9' }, { 'A', 'Z' }, { '_', '_' }, { 'a', 'z' } };
+        static const Node::Ranges SPACES = {
+            { '\t', '\r' }, { ' ', ' ' }, { 0xA0, 0xA0 }, { 0x1680, 0x1680 }, { 0x2000, 0x200A },
+            { 0x2028, 0x2029 }, { 0x202F, 0x202F }, { 0x205F, 0x205F }, { 0x3000, 0x3000 }, { 0xFEFF, 0xFEFF },
+        };
+
+        check(!atEnd(), "Trailing '\\'");
+        u32 ch = chars[pos++];
+        switch (ch) {
+            case 'd': return DIGITS;
+            case 'D': return negate(DIGITS);
+            case 'w': return WORD;
+            case 'W': return negate(WORD);
+            case 's': return SPACES;
+            case 'S': return negate(SPACES);
+            case 'n': return { { '\n', '\n' } };
+            case 'r': return { { '\r', '\r' } };
+            case 't': return { { '\t', '\t' } };
+            case 'f': return { { '\f', '\f' } };
+            case 'v': return { { '\v', '\v' } };
+            case '0': return { { 0, 0 } };
+            case 'x': {
+                u32 value = parseHex(2);
+                return { { value, value } };
+            }
+            case 'u': {
+                u32 value = parseHex(4);
+                return { { value, value } };
+            }
+            case 'c': {
+                check(!atEnd() && ((chars[pos] | 0x20) >= 'a' && (chars[pos] | 0x20) <= 'z'), "Invalid control escape");
+                u32 value = chars[pos++] % 32;
+                return { { value, value } };
+            }
+            case 'b': {
+                // A backspace inside of classes.
+                check(inClass, "Word boundaries are not supported");
+                return { { '\b', '\b' } };
+            }
+            case 'B': {
+                check(false, "Word boundaries are not supported");
+            } break;
+            default: {
+                check(ch < '1' || ch > '9', "Backreferences are not supported");
+            } break;
+        }
+        return { { ch, ch } };
+    }
+
+    u32 parseHex(int digits) {
+        u32 ret = 0;
+        for (int i = 0; i < digits; i++) {
+            check(!atEnd() && chars[pos] < 0x80, "Invalid hexadecimal escape");
+            int digit = Numbers::digitValue((char)chars[pos++]);
+            check(digit < 16, "Invalid hexadecimal escape");
+            ret = ret * 16 + digit;
+        }
+        return ret;
+    }
+
+    static bool isSingle(const Node::Ranges& ranges) {
+        return ranges.size() == 1 && ranges[0].first == ranges[0].second;
+    }
+
+    // Sorted, with overlapping and adjacent ranges merged.
+    static Node::Ranges normalize(Node::Ranges ranges) {
+        std::sort(ranges.begin(), ranges.end());
+        Node::Ranges ret;
+        for (const std::pair<u32, u32>& range : ranges) {
+            if (!ret.empty() && range.first <= ret.back().second + 1) {
+                ret.back().second = std::max(ret.back().second, range.second);
+            } else {
+                ret.push_back(range);
+            }
+        }
+        return ret;
+    }
+
+    static Node::Ranges negate(const Node::Ranges& ranges) {
+        Node::Ranges ret;
+        u32 next = 0;
+        for (const std::pair<u32, u32>& range : normalize(ranges)) {
+            if (range.first > next) {
+                ret.emplace_back(next, range.first - 1);
+            }
+            next = range.second + 1;
+        }
+        if (next <= MAX_CODEPOINT) {
+            ret.emplace_back(next, MAX_CODEPOINT);
+        }
+        return ret;
+    }
+};
+
+//
+// Compilation
+//
+
+// A set of codepoints that is encoded as a sequence of byte ranges.
+struct Utf8Range {
+    byte lo[4];
+    byte hi[4];
+    int length;
+
+    static int encode(u32 ch, byte* out) {
+        if (ch < 0x80) {
+            out[0] = (byte)ch;
+            return 1;
+        } else if (ch < 0x800) {
+            out[0] = (byte)(0xC0 | (ch >> 6));
+            out[1] = (byte)(0x80 | (ch & 0x3F));
+            return 2;
+        } else if (ch < 0x10000) {
+            out[0] = (byte)(0xE0 | (ch >> 12));
+            out[1] = (byte)(0x80 | ((ch >> 6) & 0x3F));
+            out[2] = (byte)(0x80 | (ch & 0x3F));
+            return 3;
+        }
+        out[0] = (byte)(0xF0 | (ch >> 18));
+        out[1] = (byte)(0x80 | ((ch >> 12) & 0x3F));
+        out[2] = (byte)(0x80 | ((ch >> 6) & 0x3F));
+        out[3] = (byte)(0x80 | (ch & 0x3F));
+        return 4;
+    }
+
+    // Splits lo to hi into ranges of codepoints with the same encoded length,
+    // whose continuation bytes all cover either a single value or the whole range of continuation bytes.
+    static void split(u32 lo, u32 hi, std::vector<Utf8Range>& out) {
+        static constexpr u32 LENGTH_LIMITS[] = { 0x7F, 0x7FF, 0xFFFF };
+        for (u32 limit : LENGTH_LIMITS) {
+            if (lo <= limit && hi > limit) {
+                split(lo, limit, out);
+                split(limit + 1, hi, out);
+                return;
+            }
+        }
+
+        Utf8Range range;
+        range.length = encode(lo, range.lo);
+        for (int i = 1; i < range.length; i++) {
+            u32 mask = (1u << (6 * i)) - 1;
+            if ((lo & ~mask) != (hi & ~mask)) {
+                if ((lo & mask) != 0) {
+                    split(lo, lo | mask, out);
+                    split((lo | mask) + 1, hi, out);
+                    return;
+                }
+                if ((hi & mask) != mask) {
+                    split(lo, (hi & ~mask) - 1, out);
+                    split(hi & ~mask, hi, out);
+                    return;
+                }
+            }
+        }
+        encode(hi, range.hi);
+        out.push_back(range);
+    }
+};
+
+// A Thompson NFA over bytes.
+struct Regex::Program {
+    enum class Op : u8 {
+        // Consumes a byte between lo and hi.
+        BYTE_RANGE,
+        // Continues at next and alt, preferring next.
+        SPLIT,
+        // Only continue at the start and the end of the text respectively.
+        BEGIN,
+        END,
+        MATCH,
+    };
+
+    struct Inst {
+        Op op;
+        byte lo = 0;
+        byte hi = 0;
+        int next = -1;
+        int alt = -1;
+    };
+
+    static constexpr int MAX_INSTS = 100'000;
+
+    std::vector<Inst> insts;
+    int start;
+    bool reversed;
+
+    // The reversed program is anchored, the forward one skips any bytes in front of the match, preferring to skip less.
+    Program(const Node& root, bool reversed) : reversed(reversed) {
+        start = compile(root, add({ Op::MATCH }));
+        if (!reversed) {
+            int loop = add({ Op::SPLIT, 0, 0, start });
+            insts[loop].alt = add({ Op::BYTE_RANGE, 0x00, 0xFF, loop });
+            start = loop;
+        }
+    }
+
+    int add(const Inst& inst) {
+        PGE_ASSERT(insts.size() < MAX_INSTS, "Regex is too large");
+        insts.push_back(inst);
+        return (int)insts.size() - 1;
+    }
+
+    int addSplit(int preferred, int other) {
+        return add({ Op::SPLIT, 0, 0, preferred, other });
+    }
+
+    // Compiles back to front, so that the instruction to continue at is always known.
+    int compile(const Node& node, int next) {
+        switch (node.type) {
+            case Node::Type::EMPTY: {
+                return next;
+            }
+            case Node::Type::CHARS: {
+                return compileChars(node.ranges, next);
+            }
+            case Node::Type::CONCAT: {
+                if (reversed) {
+                    for (const Node& child : node.children) {
+                        next = compile(child, next);
+                    }
+                } else {
+                    for (auto it = node.children.rbegin(); it != node.children.rend(); it++) {
+                        next = compile(*it, next);
+                    }
+                }
+                return next;
+            }
+            case Node::Type::ALTERNATE: {
+                std::vector<int> entries;
+                for (const Node& child : node.children) {
+                    entries.push_back(compile(child, next));
+                }
+                int entry = entries.back();
+                for (int i = (int)entries.size() - 2; i >= 0; i--) {
+                    entry = addSplit(entries[i], entry);
+                }
+                return entry;
+            }
+            case Node::Type::REPEAT: {
+                return compileRepeat(node, next);
+            }
+            case Node::Type::BEGIN: {
+                return add({ reversed ? Op::END : Op::BEGIN, 0, 0, next });
+            }
+            case Node::Type::END: {
+                return add({ reversed ? Op::BEGIN : Op::END, 0, 0, next });
+            }
+        }
+        return next;
+    }
+
+    int compileRepeat(const Node& node, int next) {
+        const Node& child = node.children[0];
+        int entry = next;
+        if (node.max < 0) {
+            // The child loops back to the split in front of it.
+            entry = addSplit(-1, -1);
+            int body = compile(child, entry);
+            insts[entry].next = node.greedy ? body : next;
+            insts[entry].alt = node.greedy ? next : body;
+        } else {
+            // Nested optional copies, x{0,2} is (x(x)?)?
+            for (int i = node.min; i < node.max; i++) {
+                int body = compile(child, entry);
+                entry = node.greedy ? addSplit(body, next) : addSplit(next, body);
+            }
+        }
+        for (int i = 0; i < node.min; i++) {
+            entry = compile(child, entry);
+        }
+        return entry;
+    }
+
+    int compileChars(const Node::Ranges& ranges, int next) {
+        std::vector<Utf8Range> sequences;
+        for (const std::pair<u32, u32>& range : ranges) {
+            Utf8Range::split(range.first, range.second, sequences);
+        }
+        if (sequences.empty()) {
+            // Never matches.
+            return add({ Op::BYTE_RANGE, 1, 0, next });
+        }
+        int entry = -1;
+        for (auto it = sequences.rbegin(); it != sequences.rend(); it++) {
+            int sequence = next;
+            for (int i = 0; i < it->length; i++) {
+                int index = reversed ? i : it->length - 1 - i;
+                sequence = add({ Op::BYTE_RANGE, it->lo[index], it->hi[index], sequence });
+            }
+            entry = entry < 0 ? sequence : addSplit(sequence, entry);
+        }
+        return entry;
+    }
+};
+
+//
+// Matching
+//
+
+// Simulates the program on the sets of instructions it can be at, building each set the first time it is reached.
+// A search looks at every byte it passes once and builds at most one set per byte.
+struct Regex::Dfa {
+    // One column per byte and one for reaching the end of the text.
+    static constexpr int END_OF_TEXT = 256;
+    static constexpr int COLUMNS = 257;
+    static constexpr int UNKNOWN = -1;
+    static constexpr int DEAD = 0;
+    // Once exceeded, all states are thrown away and built again as needed.
+    static constexpr int MAX_STATES = 2048;
+
+    struct InstsHash {
+        size_t operator()(const std::vector<int>& insts) const {
+            return (size_t)Hasher::getHash(std::span<const int>(insts));
+        }
+    };
+
+    const Program& program;
+    // Leftmost-first drops all threads of lower priority than a match, leftmost-longest keeps them running.
+    bool longest;
+
+    // Instructions of every state in priority order, only those waiting for a byte or for the end of the text.
+    std::vector<std::vector<int>> states;
+    std::vector<bool> matching;
+    std::unordered_map<std::vector<int>, int, InstsHash> indices;
+    std::vector<int> transitions;
+    // At the start of the text and elsewhere.
+    int startStates[2];
+
+    // Scratch space for building states.
+    std::vector<int> stack;
+    std::vector<int> visited;
+    int generation = 0;
+    std::vector<int> built;
+    bool builtMatch;
+
+    Dfa(const Program& program, bool longest) : program(program), longest(longest), visited(program.insts.size(), 0) {
+        reset();
+    }
+
+    static Dfa& get(std::unique_ptr<Dfa>& dfa, const Program& program, bool longest) {
+        if (dfa == nullptr) {
+            dfa = std::make_unique<Dfa>(program, longest);
+        }
+        return *dfa;
+    }
+
+    void reset() {
+        states.clear();
+        matching.clear();
+        indices.clear();
+        transitions.clear();
+        startStates[0] = UNKNOWN;
+        startStates[1] = UNKNOWN;
+        addState({ }, false);
+    }
+
+    int addState(const std::vector<int>& insts, bool match) {
+        auto [it, inserted] = indices.try_emplace(insts, (int)states.size());
+        if (inserted) {
+            states.push_back(insts);
+            matching.push_back(match);
+            transitions.resize(transitions.size() + COLUMNS, UNKNOWN);
+        }
+        return it->second;
+    }
+
+    void beginBuilding() {
+        built.clear();
+        builtMatch = false;
+        generation++;
+    }
+
+    // Follows everything that doesn't consume a byte, adding the instructions reached to built in priority order.
+    // Returns false if a match cut off everything of lower priority.
+    bool addClosure(int root, bool atBegin, bool atEnd) {
+        stack.push_back(root);
+        while (!stack.empty()) {
+            int index = stack.back();
+            stack.pop_back();
+            if (visited[index] == generation) {
+                continue;
+            }
+            visited[index] = generation;
+
+            const Program::Inst& inst = program.insts[index];
+            switch (inst.op) {
+                case Program::Op::SPLIT: {
+                    stack.push_back(inst.alt);
+                    stack.push_back(inst.next);
+                } break;
+                case Program::Op::BEGIN: {
+                    if (atBegin) {
+                        stack.push_back(inst.next);
+                    }
+                } break;
+                case Program::Op::END: {
+                    if (atEnd) {
+                        stack.push_back(inst.next);
+                    } else {
+                        built.push_back(index);
+                    }
+                } break;
+                case Program::Op::BYTE_RANGE: {
+                    built.push_back(index);
+                } break;
+                case Program::Op::MATCH: {
+                    built.push_back(index);
+                    builtMatch = true;
+                    if (!longest) {
+                        stack.clear();
+                        return false;
+                    }
+                } break;
+            }
+        }
+        return true;
+    }
+
+    int getStart(bool atBegin) {
+        int& start = startStates[atBegin];
+        if (start == UNKNOWN) {
+            beginBuilding();
+            addClosure(program.start, atBegin, false);
+            start = addState(built, builtMatch);
+        }
+        return start;
+    }
+
+    // May rebuild the cache, which moves state.
+    int next(int& state, int column) {
+        int cached = transitions[state * COLUMNS + column];
+        if (cached != UNKNOWN) {
+            return cached;
+        }
+
+        if ((int)states.size() >= MAX_STATES) {
+            std::vector<int> current = std::move(states[state]);
+            bool currentMatch = matching[state];
+            reset();
+            state = addState(current, currentMatch);
+        }
+
+        beginBuilding();
+        for (int index : states[state]) {
+            const Program::Inst& inst = program.insts[index];
+            bool goOn = true;
+            if (column == END_OF_TEXT) {
+                if (inst.op == Program::Op::END) {
+                    goOn = addClosure(inst.next, false, true);
+                } else if (inst.op == Program::Op::MATCH) {
+                    goOn = addClosure(index, false, true);
+                }
+            } else if (inst.op == Program::Op::BYTE_RANGE && inst.lo <= column && column <= inst.hi) {
+                goOn = addClosure(inst.next, false, false);
+            }
+            if (!goOn) {
+                break;
+            }
+        }
+        int ret = addState(built, builtMatch);
+        transitions[state * COLUMNS + column] = ret;
+        return ret;
+    }
+
+    // The end of the first match starting at or after from, negative if there is none.
+    int findEnd(const char* buf, int length, int from) {
+        int state = getStart(from == 0);
+        int end = matching[state] ? from : -1;
+        for (int i = from; i < length; i++) {
+            state = next(state, (byte)buf[i]);
+            if (state == DEAD) {
+                return end;
+            }
+            if (matching[state]) {
+                end = i + 1;
+            }
+        }
+        state = next(state, END_OF_TEXT);
+        return matching[state] ? length : end;
+    }
+
+    // Runs the reversed program backwards from end, returning the smallest start of a match not before from.
+    int findStart(const char* buf, int length, int end, int from) {
+        int state = getStart(end == length);
+        int start = matching[state] ? end : -1;
+        for (int i = end - 1; i >= from; i--) {
+            state = next(state, (byte)buf[i]);
+            if (state == DEAD) {
+                return start;
+            }
+            if (matching[state]) {
+                start = i;
+            }
+        }
+        if (from == 0) {
+            state = next(state, END_OF_TEXT);
+            if (matching[state]) {
+                start = 0;
+            }
+        }
+        return start;
+    }
+};
+
+//
+// Regex
+//
+
+Regex::Regex(const StringView& pattern) {
+    Node root = Parser(pattern).parse();
+    forward = std::make_shared<const Program>(root, false);
+    reverse = std::make_shared<const Program>(root, true);
+}
+
+Regex::Regex(const Regex& other)
+    : forward(other.forward), reverse(other.reverse) { }
+
+Regex::Regex(Regex&& other) noexcept = default;
+
+Regex& Regex::operator=(const Regex& other) {
+    forward = other.forward;
+    reverse = other.reverse;
+    forwardDfa.reset();
+    reverseDfa.reset();
+    return *this;
+}
+
+Regex& Regex::operator=(Regex&& other) noexcept = default;
+
+Regex::~Regex() = default;
+
+bool Regex::search(const StringView& str, int from, int& start, int& end) const {
+    end = Dfa::get(forwardDfa, *forward, false).findEnd(str.data(), str.byteLength(), from);
+    if (end < 0) {
+        return false;
+    }
+    start = Dfa::get(reverseDfa, *reverse, true).findStart(str.data(), str.byteLength(), end, from);
+    return true;
+}
+
+std::optional<StringView> Regex::find(const StringView& str) const {
+    int start;
+    int end;
+    if (!search(str, 0, start, end)) {
+        return std::nullopt;
+    }
+    return StringView(str.data() + start, end - start);
+}
+
+bool Regex::matches(const StringView& str) const {
+    return Dfa::get(reverseDfa, *reverse, true).findStart(str.data(), str.byteLength(), str.byteLength(), 0) == 0;
+}
+
+std::vector<StringView> Regex::findAll(const StringView& str) const {
+    std::vector<StringView> ret;
+    int from = 0;
+    int start;
+    int end;
+    while (from <= str.byteLength() && search(str, from, start, end)) {
+        ret.emplace_back(str.data() + start, end - start);
+        from = end;
+        if (start == end) {
+            // The same empty match would be found again.
+            from += end < str.byteLength() ? Unicode::measureCodepoint(str.data()[end]) : 1;
+        }
+    }
+    return ret;
+}
+
+String Regex::replace(const StringView& str, const StringView& replacement) const {
+    StringBuilder builder(str.byteLength());
+    const char* copied = str.data();
+    for (const StringView& match : findAll(str)) {
+        builder.appendBytes(std::span<const char>(copied, match.data()));
+        builder.appendBytes(std::span<const char>(replacement.data(), replacement.byteLength()));
+        copied = match.data() + match.byteLength();
+    }
+    builder.appendBytes(std::span<const char>(copied, str.data() + str.byteLength()));
+    return builder.build();
+}
@@ -0,0 +1,119 @@
+#include "SearchHelper.h"
+
+#include "SimdHelper.h"
+
+#include <algorithm>
+
+using namespace PGE;
+
+Searcher::Searcher(const char* needle, int needleLength)
+    : needle(needle), needleLength(needleLength) {
+    if (needleLength <= MAX_SHORT_NEEDLE_LENGTH) { return; }
+
+    forwardShifts = std::make_unique<int[]>(256);
+    backwardShifts = std::make_unique<int[]>(256);
+    std::fill_n(forwardShifts.get(), 256, needleLength);
+    std::fill_n(backwardShifts.get(), 256, needleLength);
+    // Distance from the last byte of the needle to the rightmost other occurrence of every byte.
+    for (int i = 0; i < needleLength - 1; i++) {
+        forwardShifts[(byte)needle[i]] = needleLength - 1 - i;
+    }
+    // Distance from the first byte of the needle to the leftmost other occurrence of every byte.
+    for (int i = needleLength - 1; i > 0; i--) {
+        backwardShifts[(byte)needle[i]] = i;
+    }
+}
+
+int Searcher::findFirst(const char* haystack, int haystackLength, int from) const {
+    // Last position an occurrence could start at.
+    int last = haystackLength - needleLength;
+    if (from > last) { return -1; }
+    if (needleLength == 0) { return from; }
+    if (needleLength == 1) {
+        const void* found = memchr(haystack + from, needle[0], haystackLength - from);
+        return found == nullptr ? -1 : (int)((const char*)found - haystack);
+    }
+    return needleLength <= MAX_SHORT_NEEDLE_LENGTH ? findFirstShort(haystack, last, from) : findFirstLong(haystack, last, from);
+}
+
+int Searcher::findLast(const char* haystack, int haystackLength, int from) const {
+    from = std::min(from, haystackLength - needleLength);
+    if (from < 0) { return -1; }
+    if (needleLength == 0) { return from; }
+    return needleLength <= MAX_SHORT_NEEDLE_LENGTH ? findLastShort(haystack, from) : findLastLong(haystack, from);
+}
+
+int Searcher::findFirstShort(const char* haystack, int last, int from) const {
+    char firstByte = needle[0];
+    char lastByte = needle[needleLength - 1];
+    int pos = from;
+#ifdef PGE_SIMD
+    // Every lane is a candidate start, the second load covers the bytes the candidates' occurrences would end on.
+    for (; pos + Simd::BLOCK_SIZE - 1 <= last; pos += Simd::BLOCK_SIZE) {
+        Simd::Mask mask = Simd::equalMask(haystack + pos, firstByte, haystack + pos + needleLength - 1, lastByte);
+        while (mask != 0) {
+            int candidate = pos + Simd::lowestLane(mask);
+            if (memcmp(haystack + candidate, needle, needleLength) == 0) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; pos <= last; pos++) {
+        if (haystack[pos] == firstByte && memcmp(haystack + pos, needle, needleLength) == 0) {
+            return pos;
+        }
+    }
+    return -1;
+}
+
+int Searcher::findLastShort(const char* haystack, int from) const {
+    char firstByte = needle[0];
+    char lastByte = needle[needleLength - 1];
+    int pos = from;
+#ifdef PGE_SIMD
+    // Here the block ends on the candidate at pos.
+    for (; pos - Simd::BLOCK_SIZE + 1 >= 0; pos -= Simd::BLOCK_SIZE) {
+        int blockStart = pos - Simd::BLOCK_SIZE + 1;
+        Simd::Mask mask = Simd::equalMask(haystack + blockStart, firstByte, haystack + blockStart + needleLength - 1, lastByte);
+        while (mask != 0) {
+            int lane = Simd::highestLane(mask);
+            if (memcmp(haystack + blockStart + lane, needle, needleLength) == 0) {
+                return blockStart + lane;
+            }
+            mask = Simd::clearLane(mask, lane);
+        }
+    }
+#endif
+    for (; pos >= 0; pos--) {
+        if (haystack[pos] == firstByte && memcmp(haystack + pos, needle, needleLength) == 0) {
+            return pos;
+        }
+    }
+    return -1;
+}
+
+int Searcher::findFirstLong(const char* haystack, int last, int from) const {
+    char lastByte = needle[needleLength - 1];
+    for (int pos = from; pos <= last;) {
+        char ch = haystack[pos + needleLength - 1];
+        if (ch == lastByte && memcmp(haystack + pos, needle, needleLength - 1) == 0) {
+            return pos;
+        }
+        pos += forwardShifts[(byte)ch];
+    }
+    return -1;
+}
+
+int Searcher::findLastLong(const char* haystack, int from) const {
+    char firstByte = needle[0];
+    for (int pos = from; pos >= 0;) {
+        char ch = haystack[pos];
+        if (ch == firstByte && memcmp(haystack + pos + 1, needle + 1, needleLength - 1) == 0) {
+            return pos;
+        }
+        pos -= backwardShifts[(byte)ch];
+    }
+    return -1;
+}
@@ -0,0 +1,45 @@
+#ifndef PGE_INTERNAL_SEARCHHELPER_H_INCLUDED
+#define PGE_INTERNAL_SEARCHHELPER_H_INCLUDED
+
+#include <memory>
+
+#include <PGE/Types/Types.h>
+
+namespace PGE {
+
+/// Byte-wise substring search, shared by all String operations that look for a needle.
+/// Short needles are located via a SIMD filter on their first and last byte, long needles via Horspool.
+/// Matches of well-formed UTF-8 needles in well-formed UTF-8 always start at a codepoint boundary.
+class Searcher {
+    public:
+        /// The needle is not copied and has to outlive the searcher.
+        Searcher(const char* needle, int needleLength);
+
+        /// Byte position of the first occurrence that starts at or after from.
+        /// An empty needle is found at from itself.
+        /// @returns -1 if there is no such occurrence.
+        int findFirst(const char* haystack, int haystackLength, int from) const;
+        /// Byte position of the last occurrence that starts at or before from.
+        /// @returns -1 if there is no such occurrence.
+        int findLast(const char* haystack, int haystackLength, int from) const;
+
+    private:
+        // Needles up to this length are handled by the SIMD filter.
+        static constexpr int MAX_SHORT_NEEDLE_LENGTH = 32;
+
+        const char* needle;
+        int needleLength;
+
+        // Horspool bad character shifts for both directions, only allocated for long needles.
+        std::unique_ptr<int[]> forwardShifts;
+        std::unique_ptr<int[]> backwardShifts;
+
+        int findFirstShort(const char* haystack, int last, int from) const;
+        int findLastShort(const char* haystack, int from) const;
+        int findFirstLong(const char* haystack, int last, int from) const;
+        int findLastLong(const char* haystack, int from) const;
+};
+
+}
+
+#endif // PGE_INTERNAL_SEARCHHELPER_H_INCLUDED
@@ -0,0 +1,162 @@
+#ifndef PGE_INTERNAL_SIMDHELPER_H_INCLUDED
+#define PGE_INTERNAL_SIMDHELPER_H_INCLUDED
+
+#include <bit>
+#include <cstring>
+
+#include <PGE/Types/Types.h>
+#include <PGE/Types/Simd.h>
+
+namespace PGE {
+
+namespace Simd {
+#if defined(PGE_SIMD_AVX2)
+    constexpr int BLOCK_SIZE = 32;
+#elif defined(PGE_SIMD)
+    constexpr int BLOCK_SIZE = 16;
+#else
+    constexpr int BLOCK_SIZE = 8;
+#endif
+
+    /// Whether the BLOCK_SIZE bytes starting at buf are all ASCII.
+    inline bool isAsciiBlock(const char* buf) {
+#if defined(PGE_SIMD_AVX2)
+        return _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)buf)) == 0;
+#elif defined(PGE_SIMD_SSE2)
+        return _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)buf)) == 0;
+#elif defined(PGE_SIMD_NEON)
+        return vmaxvq_u8(vld1q_u8((const u8*)buf)) < 0x80;
+#else
+        u64 word;
+        memcpy(&word, buf, sizeof(word));
+        return (word & 0x8080808080808080u) == 0;
+#endif
+    }
+
+    /// Writes the block at src to dst, flipping the case of the bytes in [first, first + 25].
+    /// Passing 'a' uppercases ASCII letters, passing 'A' lowercases them.
+    inline void flipAsciiCaseBlock(const char* src, char* dst, char first) {
+#if defined(PGE_SIMD_AVX2)
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)src);
+        // Shifting the range down to the lowest signed values allows for a single signed comparison.
+        __m256i shifted = _mm256_sub_epi8(chunk, _mm256_set1_epi8((char)(first + 128)));
+        __m256i inRange = _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26), shifted);
+        _mm256_storeu_si256((__m256i*)dst, _mm256_xor_si256(chunk, _mm256_and_si256(inRange, _mm256_set1_epi8(0x20))));
+#elif defined(PGE_SIMD_SSE2)
+        __m128i chunk = _mm_loadu_si128((const __m128i*)src);
+        __m128i shifted = _mm_sub_epi8(chunk, _mm_set1_epi8((char)(first + 128)));
+        __m128i inRange = _mm_cmpgt_epi8(_mm_set1_epi8(-128 + 26), shifted);
+        _mm_storeu_si128((__m128i*)dst, _mm_xor_si128(chunk, _mm_and_si128(inRange, _mm_set1_epi8(0x20))));
+#elif defined(PGE_SIMD_NEON)
+        uint8x16_t chunk = vld1q_u8((const u8*)src);
+        uint8x16_t inRange = vcltq_u8(vsubq_u8(chunk, vdupq_n_u8((u8)first)), vdupq_n_u8(26));
+        vst1q_u8((u8*)dst, veorq_u8(chunk, vandq_u8(inRange, vdupq_n_u8(0x20))));
+#else
+        for (int i = 0; i < BLOCK_SIZE; i++) {
+            dst[i] = (u8)(src[i] - first) < 26 ? src[i] ^ 0x20 : src[i];
+        }
+#endif
+    }
+
+    /// Whether the blocks at a and b are equal once their ASCII letters are lowercased.
+    inline bool equalsIgnoreAsciiCaseBlock(const char* a, const char* b) {
+#if defined(PGE_SIMD_AVX2)
+        const __m256i offset = _mm256_set1_epi8((char)('A' + 128));
+        const __m256i limit = _mm256_set1_epi8(-128 + 26);
+        const __m256i bit = _mm256_set1_epi8(0x20);
+        __m256i chunkA = _mm256_loadu_si256((const __m256i*)a);
+        __m256i chunkB = _mm256_loadu_si256((const __m256i*)b);
+        chunkA = _mm256_or_si256(chunkA, _mm256_and_si256(_mm256_cmpgt_epi8(limit, _mm256_sub_epi8(chunkA, offset)), bit));
+        chunkB = _mm256_or_si256(chunkB, _mm256_and_si256(_mm256_cmpgt_epi8(limit, _mm256_sub_epi8(chunkB, offset)), bit));
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunkA, chunkB)) == -1;
+#elif defined(PGE_SIMD_SSE2)
+        const __m128i offset = _mm_set1_epi8((char)('A' + 128));
+        const __m128i limit = _mm_set1_epi8(-128 + 26);
+        const __m128i bit = _mm_set1_epi8(0x20);
+        __m128i chunkA = _mm_loadu_si128((const __m128i*)a);
+        __m128i chunkB = _mm_loadu_si128((const __m128i*)b);
+        chunkA = _mm_or_si128(chunkA, _mm_and_si128(_mm_cmpgt_epi8(limit, _mm_sub_epi8(chunkA, offset)), bit));
+        chunkB = _mm_or_si128(chunkB, _mm_and_si128(_mm_cmpgt_epi8(limit, _mm_sub_epi8(chunkB, offset)), bit));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(chunkA, chunkB)) == 0xFFFF;
+#elif defined(PGE_SIMD_NEON)
+        const uint8x16_t offset = vdupq_n_u8('A');
+        const uint8x16_t limit = vdupq_n_u8(26);
+        const uint8x16_t bit = vdupq_n_u8(0x20);
+        uint8x16_t chunkA = vld1q_u8((const u8*)a);
+        uint8x16_t chunkB = vld1q_u8((const u8*)b);
+        chunkA = vorrq_u8(chunkA, vandq_u8(vcltq_u8(vsubq_u8(chunkA, offset), limit), bit));
+        chunkB = vorrq_u8(chunkB, vandq_u8(vcltq_u8(vsubq_u8(chunkB, offset), limit), bit));
+        return vminvq_u8(vceqq_u8(chunkA, chunkB)) == 0xFF;
+#else
+        for (int i = 0; i < BLOCK_SIZE; i++) {
+            char chA = (u8)(a[i] - 'A') < 26 ? a[i] | 0x20 : a[i];
+            char chB = (u8)(b[i] - 'A') < 26 ? b[i] | 0x20 : b[i];
+            if (chA != chB) { return false; }
+        }
+        return true;
+#endif
+    }
+
+#ifdef PGE_SIMD
+    // Comparison results are condensed into a scalar mask with MASK_BITS_PER_LANE bits per byte lane.
+    // Only the lowest bit of every lane is kept, so `mask &= mask - 1` steps from one matching lane to the next.
+#if defined(PGE_SIMD_NEON)
+    using Mask = u64;
+    constexpr int MASK_BITS_PER_LANE = 4;
+
+    inline Mask toMask(uint8x16_t cmp) {
+        uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x1111111111111111u;
+    }
+#else
+    using Mask = u32;
+    constexpr int MASK_BITS_PER_LANE = 1;
+#endif
+
+    /// Mask of the lanes of the block at buf that are equal to ch.
+    inline Mask equalMask(const char* buf, char ch) {
+#if defined(PGE_SIMD_AVX2)
+        __m256i cmp = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)buf), _mm256_set1_epi8(ch));
+        return (Mask)_mm256_movemask_epi8(cmp);
+#elif defined(PGE_SIMD_SSE2)
+        __m128i cmp = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)buf), _mm_set1_epi8(ch));
+        return (Mask)_mm_movemask_epi8(cmp);
+#else
+        return toMask(vceqq_u8(vld1q_u8((const u8*)buf), vdupq_n_u8((u8)ch)));
+#endif
+    }
+
+    /// Mask of the lanes in which the block at a is equal to chA and the block at b is equal to chB.
+    inline Mask equalMask(const char* a, char chA, const char* b, char chB) {
+#if defined(PGE_SIMD_AVX2)
+        __m256i cmpA = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)a), _mm256_set1_epi8(chA));
+        __m256i cmpB = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)b), _mm256_set1_epi8(chB));
+        return (Mask)_mm256_movemask_epi8(_mm256_and_si256(cmpA, cmpB));
+#elif defined(PGE_SIMD_SSE2)
+        __m128i cmpA = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)a), _mm_set1_epi8(chA));
+        __m128i cmpB = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)b), _mm_set1_epi8(chB));
+        return (Mask)_mm_movemask_epi8(_mm_and_si128(cmpA, cmpB));
+#else
+        uint8x16_t cmpA = vceqq_u8(vld1q_u8((const u8*)a), vdupq_n_u8((u8)chA));
+        uint8x16_t cmpB = vceqq_u8(vld1q_u8((const u8*)b), vdupq_n_u8((u8)chB));
+        return toMask(vandq_u8(cmpA, cmpB));
+#endif
+    }
+
+    inline int lowestLane(Mask mask) {
+        return std::countr_zero(mask) / MASK_BITS_PER_LANE;
+    }
+
+    inline int highestLane(Mask mask) {
+        return (std::bit_width(mask) - 1) / MASK_BITS_PER_LANE;
+    }
+
+    inline Mask clearLane(Mask mask, int lane) {
+        return mask & ~((Mask)1 << (lane * MASK_BITS_PER_LANE));
+    }
+#endif
+}
+
+}
+
+#endif // PGE_INTERNAL_SIMDHELPER_H_INCLUDED
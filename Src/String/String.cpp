@@ -1,11 +1,21 @@
 #include <PGE/String/String.h>
+#include <PGE/String/StringBuilder.h>
+#include <PGE/String/Key.h>
+#include <PGE/String/Regex.h>
 #include <PGE/String/Unicode.h>
 #include "UnicodeInternal.h"
 #include "UnicodeHelper.h"
+#include "SearchHelper.h"
+#include "NumberHelper.h"
+#include "SimdHelper.h"
 
 #include <limits>
+#include <algorithm>
+#include <execution>
+#include <charconv>
+#include <bit>
 #include <iostream>
-#include <mutex>
+#include <memory>
 #if defined(__APPLE__) && defined(__OBJC__)
 #import <Foundation/Foundation.h>
 #endif
@@ -22,12 +32,14 @@ using namespace PGE;
 void String::BasicIterator::increment() {
     if (index < 0) { *this = ref->begin(); return; }
     index += Unicode::measureCodepoint(ref->cstr()[index]);
+    _ch = L'\uFFFF';
+    // A negative character index means it has not been evaluated yet.
+    if (charIndex < 0) { return; }
     charIndex++;
     // We reached the end and get the str length for free.
-    if (index == ref->byteLength()) {
-        ref->getData()->_strLength = charIndex;
+    if (index == ref->byteLength() && !ref->isShort()) {
+        ref->getData()->_strLength.store(charIndex);
     }
-    _ch = L'\uFFFF';
 }
 
 void String::BasicIterator::decrement() {
@@ -57,7 +69,7 @@ char16 String::BasicIterator::operator*() const {
 }
 
 bool String::BasicIterator::operator==(const BasicIterator& other) const {
-    return ref->getChars() == other.ref->getChars() && index == other.index;
+    return ref->cstr() == other.ref->cstr() && index == other.index;
 }
 
 int String::BasicIterator::getBytePosition() const {
@@ -66,10 +78,7 @@ int String::BasicIterator::getBytePosition() const {
 
 int String::BasicIterator::getPosition() const {
     if (charIndex < 0) {
-        charIndex = 0;
-        for (int i = 0; i < index; i += Unicode::measureCodepoint(ref->cstr()[i])) {
-            charIndex++;
-        }
+        charIndex = Unicode::countCodepoints(ref->cstr(), index);
     }
     return charIndex;
 }
@@ -98,6 +107,25 @@ String::ReverseIterator& String::ReverseIterator::operator--() {
     return *this;
 }
 
+template <> void String::Iterator::jump(int steps) {
+    int target = getPosition() + steps;
+    PGE_ASSERT(target <= ref->length(), "Tried incrementing end iterator");
+    PGE_ASSERT(target >= 0, "Tried decrementing begin iterator");
+    index = ref->getBytePosition(target);
+    charIndex = target;
+    _ch = L'\uFFFF';
+}
+
+template <> void String::ReverseIterator::jump(int steps) {
+    int target = getPosition() - steps;
+    PGE_ASSERT(target >= -1, "Tried decrementing end reverse iterator");
+    PGE_ASSERT(target < ref->length(), "Tried incrementing begin reverse iterator");
+    // Just like the end iterator, the position before the first character is -1 in both.
+    index = target < 0 ? -1 : ref->getBytePosition(target);
+    charIndex = target;
+    _ch = L'\uFFFF';
+}
+
 const inline String INVALID_ITERATOR = "Tried reversing invalid iterator";
 
 void String::Iterator::validate() {
@@ -113,7 +141,7 @@ String::Iterator String::Iterator::begin(const String& str) {
 }
 
 template <> String::Iterator String::Iterator::end(const String& str) {
-    return String::Iterator(str, str.byteLength(), str.getData()->_strLength);
+    return String::Iterator(str, str.byteLength(), str.knownLength());
 }
 
 String::ReverseIterator String::ReverseIterator::begin(const String& str) {
@@ -142,11 +170,82 @@ String::ReverseIterator String::rend() const {
 
 //
 
-String::String()
-    : internalData(StackAllocData {
-        .data = { ._hashCode = Hasher().getHash(), ._strLength = 0, .strByteLength = 0 },
-        .cstrBuf = { '\0' }
-      }) { }
+String::String() { }
+
+String::String(const String& other) {
+    copyFrom(other);
+}
+
+String::String(String&& other) noexcept {
+    moveFrom(other);
+}
+
+String& String::operator=(const String& other) {
+    if (this != &other) {
+        release();
+        copyFrom(other);
+    }
+    return *this;
+}
+
+String& String::operator=(String&& other) noexcept {
+    if (this != &other) {
+        release();
+        moveFrom(other);
+    }
+    return *this;
+}
+
+String::~String() {
+    release();
+}
+
+void String::copyFrom(const String& other) {
+    if (other.isShort()) {
+        shortData = other.shortData;
+        cstrBuf = shortData.chars;
+    } else {
+        // shortData may be the active member, which assigning can't switch from as Metadata isn't trivially copyable.
+        std::construct_at(&longData, other.longData);
+        cstrBuf = other.cstrBuf;
+        if (longData.header != nullptr) {
+            longData.header->refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void String::moveFrom(String& other) {
+    if (other.isShort()) {
+        shortData = other.shortData;
+        cstrBuf = shortData.chars;
+    } else {
+        std::construct_at(&longData, other.longData);
+        cstrBuf = other.cstrBuf;
+        // The reference is taken over, other is left empty.
+        other.shortData = { };
+        other.cstrBuf = other.shortData.chars;
+    }
+}
+
+void String::release() {
+    if (!isShort() && longData.header != nullptr) {
+        longData.header->release();
+    }
+}
+
+String::Header* String::Header::allocate(int minCapacity) {
+    size_t total = std::bit_ceil(sizeof(Header) + (size_t)minCapacity);
+    PGE_ASSERT(total - sizeof(Header) <= (size_t)std::numeric_limits<int>::max(), "Max string length exceeded!");
+    return new (::operator new(total)) Header((int)(total - sizeof(Header)));
+}
+
+void String::Header::release() {
+    // Acquiring makes all writes of other owners visible before the memory is freed.
+    if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        this->~Header();
+        ::operator delete(this);
+    }
+}
 
 String::String(const char8_t* cstr)
     : String((const char*)cstr) { }
@@ -156,52 +255,39 @@ String::String(const char16* wstri) {
 }
 
 void String::wCharToUtf8Str(const char16* wbuffer) {
-    // Determine the capacity of the cbuffer by measuring the number of bytes required for each codepoint.
-    int newCap = 0;
-    for (int i = 0; wbuffer[i] != L'\0'; i++) {
-        newCap += Unicode::wCharToUtf8(wbuffer[i], nullptr);
-    }
-    const auto& [buf, data] = reallocate(newCap);
-
-    // Convert all the wchars to codepoints.
-    int cIndex = 0;
-    // We get _strLength "for free" here.
-    for (data->_strLength = 0; wbuffer[data->_strLength] != L'\0'; data->_strLength++) {
-        cIndex += Unicode::wCharToUtf8(wbuffer[data->_strLength], &buf[cIndex]);
-    }
-    buf[newCap] = '\0';
-    data->strByteLength = newCap;
+    int len = (int)std::char_traits<char16>::length(wbuffer);
+    std::span<const char16> units(wbuffer, len);
+    int byteLength = Unicode::measureUtf8(units);
+    char* buf = reallocate(byteLength);
+    Unicode::utf16ToUtf8(units, std::span<char>(buf, byteLength));
+    setLengths(byteLength, len);
 }
 
 String::String(const std::string& cppstr) {
     int len = (int)cppstr.size();
-    const auto& [buf, data] = reallocate(len);
-    data->strByteLength = len;
-    memcpy(buf, cppstr.c_str(), len + 1);
+    char* buf = reallocate(len);
+    memcpy(buf, cppstr.c_str(), len);
+    setLengths(len);
 }
 
 #if defined(__APPLE__) && defined(__OBJC__)
 String::String(const NSString* nsstr) {
     const char* cPath = [nsstr cStringUsingEncoding: NSUTF8StringEncoding];
     int len = (int)strlen(cPath);
-    const auto& [buf, data] = reallocate(len);
-    strByteLength = len;
-    memcpy(buf, cPath, len + 1);
+    char* buf = reallocate(len);
+    memcpy(buf, cPath, len);
+    setLengths(len);
 }
 #endif
 
 String::String(char c) {
     if (c < 0) {
-        const auto& [buf, data] = reallocate(2);
-        data->strByteLength = Unicode::wCharToUtf8((char16)(unsigned char)c, buf);
-        data->_strLength = 1;
-        buf[data->strByteLength] = '\0';
+        char* buf = reallocate(2);
+        setLengths(Unicode::wCharToUtf8((char16)(unsigned char)c, buf), 1);
     } else {
-        const auto& [buf, data] = reallocate(1);
-        data->strByteLength = 1;
-        data->_strLength = 1;
+        char* buf = reallocate(1);
         buf[0] = c;
-        buf[1] = '\0';
+        setLengths(1, 1);
     }
 }
 
@@ -209,26 +295,46 @@ String::String(char8_t c)
     : String((char)c) { }
 
 String::String(char16 w) {
-    const auto& [buf, data] = reallocate(4);
-    data->strByteLength = Unicode::wCharToUtf8(w, buf);
-    data->_strLength = 1;
-    buf[data->strByteLength] = '\0';
+    char* buf = reallocate(4);
+    setLengths(Unicode::wCharToUtf8(w, buf), 1);
 }
 
 String::String(const String& a, const String& b) {
     int aLen = a.byteLength();
     int bLen = b.byteLength();
-    const auto& [buf, data] = reallocate(aLen + bLen);
+    int aLength = a.knownLength();
+    int bLength = b.knownLength();
+    char* buf = reallocate(aLen + bLen);
     memcpy(buf, a.cstr(), aLen);
-    memcpy(buf + aLen, b.cstr(), bLen + 1);
-    data->strByteLength = aLen + bLen;
-    if (a.getData()->_strLength >= 0 && b.getData()->_strLength >= 0) {
-        data->_strLength = a.length() + b.length();
+    memcpy(buf + aLen, b.cstr(), bLen);
+    // a starts the new string, so hashing it doesn't have to be redone.
+    setLengths(aLen + bLen, aLength >= 0 && bLength >= 0 ? aLength + bLength : -1, a.getHashPrefix());
+}
+
+String String::concatViews(std::span<const StringView> views) {
+    int byteLength = 0;
+    int length = 0;
+    for (const StringView& view : views) {
+        byteLength += view.byteLength();
+        // Unknown lengths are left to be counted later.
+        length = length < 0 || view._strLength < 0 ? -1 : length + view._strLength;
+    }
+    String ret;
+    char* buf = ret.reallocate(byteLength);
+    for (const StringView& view : views) {
+        memcpy(buf, view.data(), view.byteLength());
+        buf += view.byteLength();
     }
+    ret.setLengths(byteLength, length);
+    return ret;
 }
 
-String PGE::StringLiterals::operator""_PGE(const char* cstr, size_t size) {
-    return String(cstr, size);
+String::String(const StringView& view) {
+    int len = view.byteLength();
+    char* buf = reallocate(len);
+    memcpy(buf, view.data(), len);
+    // The bytes were just copied and are still in cache, so counting them now is cheap.
+    setLengths(len, view.length());
 }
 
 String PGE::StringLiterals::operator""_PGE(const char8_t* cstr, size_t size) {
@@ -244,49 +350,37 @@ String PGE::StringLiterals::operator""_PGE(const char16* wstr, size_t) {
 // Private constructors.
 //
 
-String::String(int sz, char*& charBuffer, Metadata*& data) {
-    const auto& [chs, dt] = reallocate(sz);
-    charBuffer = chs; data = dt;
+String::String(int sz, char*& charBuffer) {
+    charBuffer = reallocate(sz);
 }
 
 // Literal, size is WITHOUT terminating null byte!
 String::String(const char* cstr, size_t size)
-    : internalData(LiteralData {
-        .data = Metadata{ .strByteLength = (int)size },
-        .cstrBuf = (char*)cstr
-      }) { }
+    : String(cstr, Metadata { .strByteLength = (int)size }) { }
+
+String::String(const char* cstr, const Metadata& data)
+    : cstrBuf((char*)cstr), longData { .header = nullptr, .data = data } { }
 
-// Byte substr.
-String::String(const String& other, int from, int cnt) {
-    const auto& [buf, data] = reallocate(cnt);
-    data->strByteLength = cnt;
-    memcpy(buf, other.cstr() + from, cnt);
-    buf[cnt] = '\0';
-}
 
 void String::operator+=(const String& other) {
     int oldByteSize = byteLength();
-    int newSize = oldByteSize + other.byteLength();
-    const auto& [buf, data] = reallocate(newSize, true);
-    memcpy(buf + oldByteSize, other.cstr(), other.byteLength() + 1);
-    data->strByteLength = newSize;
-    if (data->_strLength >= 0 && other.getData()->_strLength >= 0) {
-        data->_strLength += other.length();
-    } else {
-        data->_strLength = -1;
-    }
+    int otherByteSize = other.byteLength();
+    int oldLength = knownLength();
+    int otherLength = other.knownLength();
+    Hasher::Prefix hashPrefix = getHashPrefix();
+    // other may be this string, so everything is read from it before reallocating.
+    char* buf = reallocate(oldByteSize + otherByteSize, true);
+    memcpy(buf + oldByteSize, other.cstr(), otherByteSize);
+    setLengths(oldByteSize + otherByteSize, oldLength >= 0 && otherLength >= 0 ? oldLength + otherLength : -1, hashPrefix);
 }
 
 void String::operator+=(char16 ch) {
     int aLen = byteLength();
-    const auto& [buf, data] = reallocate(aLen + 4, true);
+    int oldLength = knownLength();
+    Hasher::Prefix hashPrefix = getHashPrefix();
+    char* buf = reallocate(aLen + Unicode::wCharToUtf8(ch, nullptr), true);
     int actualSize = aLen + Unicode::wCharToUtf8(ch, buf + aLen);
-    buf[actualSize] = '\0';
-    data->strByteLength = actualSize;
-    if (data->_strLength >= 0) {
-        data->_strLength++;
-    }
-    data->_hashCode = 0; // TODO: Deal with partially evaluated hashcode.
+    setLengths(actualSize, oldLength >= 0 ? oldLength + 1 : -1, hashPrefix);
 }
 
 String PGE::operator+(const String& a, const String& b) {
@@ -321,46 +415,70 @@ std::istream& PGE::operator>>(std::istream& is, String& s) {
 }
 
 u64 String::getHashCode() const {
+    // Short strings have no room to cache it in, but hashing them is cheap anyway.
+    if (isShort()) {
+        return Hasher::getHash(std::span((byte*)cstr(), byteLength()));
+    }
     Metadata* data = getData();
-    if (data->_hashCode == 0) {
-        if (std::holds_alternative<LiteralData>(internalData)) {
-            LiteralData& lit = std::get<LiteralData>(internalData);
-            if (std::holds_alternative<Metadata>(lit.data)) {
-                data = lit.shareData();
-                if (data->_hashCode != 0) {
-                    return data->_hashCode;
-                }
-            }
-        }
-
-        data->_hashCode = Hasher::getHash(std::span((byte*)cstr(), byteLength()));
+    u64 hashCode = data->_hashCode.load();
+    if (hashCode == 0) {
+        std::span<const byte> bytes((const byte*)cstr(), byteLength());
+        // Appending keeps the progress, so only what was appended since then is hashed.
+        // The header's progress is only read here, it's shared with other threads.
+        hashCode = longData.header != nullptr ? Hasher::getHash(bytes, longData.header->hashPrefix) : Hasher::getHash(bytes);
+        data->_hashCode.store(hashCode);
     }
-    return data->_hashCode;
+    return hashCode;
 }
 
+// Byte-wise order of UTF-8 is the same as the order of the codepoints.
 std::weak_ordering String::compare(const String& other) const {
-    String::Iterator a = begin();
-    String::Iterator b = other.begin();
-    while (a != end() && b != other.end() && *a == *b) { a++; b++; }
-    if (a == end()) {
-        if (b == other.end()) {
-            return std::weak_ordering::equivalent;
-        } else {
-            return std::weak_ordering::less;
-        }
-    } else if (b == other.end()) {
-        return std::weak_ordering::greater;
-    } else {
-        return *a <=> *b;
+    int cmp = memcmp(cstr(), other.cstr(), std::min(byteLength(), other.byteLength()));
+    if (cmp != 0) {
+        return cmp < 0 ? std::weak_ordering::less : std::weak_ordering::greater;
     }
+    return byteLength() <=> other.byteLength();
+}
+
+struct SortEntry {
+    u64 prefix;
+    int index;
+};
+
+struct SortEntryLess {
+    const std::vector<String>& strs;
+
+    bool operator()(const SortEntry& a, const SortEntry& b) const {
+        if (a.prefix != b.prefix) { return a.prefix < b.prefix; }
+        return strs[a.index].compare(strs[b.index]) < 0;
+    }
+};
+
+void String::sort(std::vector<String>& strs) {
+    // Sorting small entries keeps most comparisons away from the characters and moves no strings around.
+    std::vector<SortEntry> entries(strs.size());
+    for (int i : Range((int)strs.size())) {
+        entries[i] = { OrderedKey::getPrefix(strs[i]), i };
+    }
+    std::sort(std::execution::par, entries.begin(), entries.end(), SortEntryLess { strs });
+
+    std::vector<String> sorted;
+    sorted.reserve(strs.size());
+    for (const SortEntry& entry : entries) {
+        sorted.emplace_back(std::move(strs[entry.index]));
+    }
+    strs = std::move(sorted);
 }
 
 bool String::equals(const String& other) const {
-    if (getChars() == other.getChars()) { return true; }
+    if (cstr() == other.cstr()) { return true; }
     if (byteLength() != other.byteLength()) { return false; }
+    if (isShort() || other.isShort()) { return memcmp(cstr(), other.cstr(), byteLength()) == 0; }
     Metadata* data = getData(); Metadata* otherData = other.getData();
-    if (data->_strLength >= 0 && otherData->_strLength >= 0 && length() != other.length()) { return false; }
-    if (data->_hashCode != 0 && otherData->_hashCode != 0) { return getHashCode() == other.getHashCode(); }
+    int len = data->_strLength.load(); int otherLen = otherData->_strLength.load();
+    if (len >= 0 && otherLen >= 0 && len != otherLen) { return false; }
+    u64 hashCode = data->_hashCode.load(); u64 otherHashCode = otherData->_hashCode.load();
+    if (hashCode != 0 && otherHashCode != 0) { return hashCode == otherHashCode; }
     return memcmp(cstr(), other.cstr(), byteLength()) == 0;
 }
 
@@ -373,11 +491,35 @@ static void fold(const char*& buf, CircularArray<char16>& queue) {
     }
 }
 
+static char lowerAscii(char ch) {
+    return (u8)(ch - 'A') < 26 ? ch | 0x20 : ch;
+}
+
 bool String::equalsIgnoreCase(const String& other) const {
-    if (getChars() == other.getChars()) { return true; }
-    if (getData()->_hashCode != 0 && other.getData()->_hashCode != 0 && getHashCode() == other.getHashCode()) { return true; }
+    if (cstr() == other.cstr()) { return true; }
+    if (!isShort() && !other.isShort()
+        && getData()->_hashCode.load() != 0 && other.getData()->_hashCode.load() != 0 && getHashCode() == other.getHashCode()) { return true; }
+
+    // As long as the bytes only differ in the case of ASCII letters, the folded strings are equal up to there.
+    const char* a = cstr();
+    const char* b = other.cstr();
+    int commonLength = std::min(byteLength(), other.byteLength());
+    int i = 0;
+    while (commonLength - i >= Simd::BLOCK_SIZE && Simd::equalsIgnoreAsciiCaseBlock(a + i, b + i)) {
+        i += Simd::BLOCK_SIZE;
+    }
+    while (((a[i] | b[i]) & 0x80) == 0) {
+        if (lowerAscii(a[i]) != lowerAscii(b[i])) { return false; }
+        // Both reached the terminating byte.
+        if (a[i] == '\0') { return true; }
+        i++;
+    }
+    // Non-ASCII needs full folding, starting over at the beginning of the codepoint, which is the same in both.
+    while (i > 0 && (a[i] & 0b1100'0000) == 0b1000'0000) {
+        i--;
+    }
 
-    const char* buf[2] = { cstr(), other.cstr() };
+    const char* buf[2] = { a + i, b + i };
     CircularArray<char16> queue[2];
 
     // Feed first char.
@@ -400,80 +542,87 @@ bool String::equalsIgnoreCase(const String& other) const {
         }
     }
 
-    // If the strings are really equal, then both have the null char now.
-    return *buf[0] == *buf[1];
+    // If the strings are really equal, then both have the null char now and nothing is left over from folding.
+    return *buf[0] == *buf[1] && queue[0].empty() && queue[1].empty();
 }
 
 bool String::isEmpty() const {
-    return getChars()[0] == '\0';
+    return cstrBuf[0] == '\0';
 }
 
-String::CoreInfo String::reallocate(int size, bool copyOldChs) {
+char* String::reallocate(int size, bool copyOldChs) {
     // Accounting for the terminating byte.
     size++;
 
-    CoreInfo str;
-    if (std::holds_alternative<LiteralData>(internalData)) {
+    if (isShort()) {
         if (size <= SHORT_STR_CAPACITY) {
-            LiteralData lit = std::get<LiteralData>(internalData);
-            Metadata* data = lit.getData();
-            int prevLen = data->strByteLength;
-            StackAllocData& u = internalData.emplace<StackAllocData>();
-            if (copyOldChs) {
-                memcpy(u.cstrBuf, lit.cstrBuf, prevLen);
-            }
-            u.data = *data;
-            return u.get();
+            return cstrBuf;
         }
-        str = std::get<LiteralData>(internalData).get();
-    } else if (std::holds_alternative<StackAllocData>(internalData)) {
-        if (size <= SHORT_STR_CAPACITY) {
-            return std::get<StackAllocData>(internalData).get();
+    } else if (longData.header != nullptr) {
+        if (size <= longData.header->capacity && longData.header->refCount.load(std::memory_order_acquire) == 1) {
+            return cstrBuf;
         }
-        str = std::get<StackAllocData>(internalData).get();
-    } else {
-        std::shared_ptr<HeapAllocData>& s = std::get<std::shared_ptr<HeapAllocData>>(internalData);
-        if (size <= s->cCapacity && s.use_count() == 1) {
-            return s->get();
+    } else if (size <= SHORT_STR_CAPACITY) {
+        // Literals are moved into the inline buffer, as their characters can't be written to.
+        const char* literal = cstrBuf;
+        int literalByteLength = longData.data.strByteLength;
+        shortData = { };
+        cstrBuf = shortData.chars;
+        if (copyOldChs) {
+            memcpy(cstrBuf, literal, literalByteLength);
         }
-        str = s->get();
+        return cstrBuf;
     }
 
-    int targetCapacity = 1;
-    while (targetCapacity < size && targetCapacity != 0) { targetCapacity <<= 1; }
-    PGE_ASSERT(targetCapacity != 0, "Max string length exceeded!");
-
-    std::unique_ptr<char[]> newChs = std::make_unique<char[]>(targetCapacity);
+    Header* header = Header::allocate(size);
     if (copyOldChs) {
-        memcpy(newChs.get(), str.cstrBuf, str.data->strByteLength);
+        memcpy(header->chars(), cstrBuf, byteLength());
     }
+    release();
+    std::construct_at(&longData, LongData { .header = header, .data = { } });
+    cstrBuf = header->chars();
+    return cstrBuf;
+}
 
-    std::shared_ptr<HeapAllocData>& s = internalData.emplace<std::shared_ptr<HeapAllocData>>(std::make_shared<HeapAllocData>());
-    s->cstrBuf = std::move(newChs);
-    s->cCapacity = targetCapacity;
+void String::setLengths(int newByteLength, int newLength, const Hasher::Prefix& hashPrefix) {
+    cstrBuf[newByteLength] = '\0';
+    if (isShort()) {
+        shortData.byteLength = (u8)newByteLength;
+    } else {
+        PGE_ASSERT(longData.header != nullptr, "Literals can't be written to");
+        longData.header->data = { ._hashCode = 0, ._strLength = newLength, .strByteLength = newByteLength };
+        delete longData.header->codepointIndex.exchange(nullptr, std::memory_order_relaxed);
+        longData.header->hashPrefix = hashPrefix;
+    }
+}
 
-    return s->get();
+Hasher::Prefix String::getHashPrefix() const {
+    if (isShort() || longData.header == nullptr) { return Hasher::Prefix(); }
+    Hasher::Prefix prefix = longData.header->hashPrefix;
+    // Only worth catching up for strings whose hash is asked for, those are likely hashed again after appending.
+    if (longData.header->data._hashCode.load() != 0) {
+        Hasher::advance(std::span((const byte*)cstrBuf, byteLength()), prefix);
+    }
+    return prefix;
 }
 
-const char* String::cstr() const {
-    return getChars();
+String::Metadata* String::getData() const {
+    PGE_ASSERT(!isShort(), "Short strings have no metadata");
+    return longData.header != nullptr ? &longData.header->data : const_cast<Metadata*>(&longData.data);
+}
+
+int String::knownLength() const {
+    return isShort() ? -1 : getData()->_strLength.load();
 }
 
 const char8_t* String::c8str() const {
-    return (const char8_t*)getChars();
+    return (const char8_t*)cstrBuf;
 }
 
 std::vector<char16> String::wstr() const {
-    std::vector<char16> chars;
-    Metadata* data = getData();
-    if (data->_strLength >= 0) {
-        chars.reserve(data->_strLength);
-    }
-    // Convert all the codepoints to wchars.
-    for (char16 ch : *this) {
-        chars.emplace_back(ch);
-    }
-    chars.emplace_back(L'\0');
+    std::vector<char16> chars(length() + 1);
+    Unicode::utf8ToUtf16(std::span<const char>(cstr(), byteLength()), chars);
+    chars.back() = L'\0';
     return chars;
 }
 
@@ -489,8 +638,8 @@ static consteval byte maxIntegerDigits(byte base) {
 template <std::integral I, byte BASE> requires ValidBaseForType<I, BASE>
 String String::fromInteger(I i, Casing casing) {
     constexpr byte digits = maxIntegerDigits<I>(BASE);
-    char* buf; Metadata* retData;
-    String ret(digits, buf, retData);
+    char* buf;
+    String ret(digits, buf);
 
     byte count = 0;
     if constexpr (std::numeric_limits<I>::is_signed) {
@@ -518,67 +667,15 @@ String String::fromInteger(I i, Casing casing) {
     }
     std::reverse(buf, buf + count);
 
-    retData->strByteLength = count;
-    retData->_strLength = retData->strByteLength;
+    ret.setLengths(count, count);
     return ret;
 }
 
-static bool parseOptionalSign(String::Iterator& it, const String& str) {
-    if (it != str.end()) {
-        if (*it == L'-') {
-            it++;
-            return true;
-        } else if (*it == L'+') {
-            it++;
-        }
-    }
-    return false;
-}
-
-template <char16 FIRST_CHAR, char16 LAST_CHAR, byte EXTRA = 0>
-static bool charInRange(byte& digit, char16 ch) {
-    if (ch < FIRST_CHAR || ch > LAST_CHAR) { return false; }
-    digit = (byte)(ch - FIRST_CHAR + EXTRA);
-    return true;
-}
-
-template <byte BASE>
-static bool charToDigit(byte& digit, char16 ch) {
-    if (charInRange<L'0', L'9'>(digit, ch)) { return true; }
-
-    if constexpr (BASE > 10) {
-        if (charInRange<L'A', L'A' + BASE - 11, 10>(digit, ch)) { return true; }
-        if (charInRange<L'a', L'a' + BASE - 11, 10>(digit, ch)) { return true; }
-    }
-
-    return false;
-}
-
 template <std::integral I, byte BASE = 10>  requires ValidBaseForType<I, BASE>
 static I toInteger(const String& str, bool& success) {
-    success = false;
-    I ret = 0;
-    String::Iterator it = str.begin();
-    bool neg = false;
-    if constexpr (std::numeric_limits<I>::is_signed) {
-        neg = parseOptionalSign(it, str);
-    }
-    for (; it != str.end(); it++) {
-        char16 ch = *it;
-        if (ret > std::numeric_limits<I>::max() / BASE) { return 0; }
-        ret *= BASE;
-        byte digit;
-        if (!charToDigit<BASE>(digit, ch)) { return 0; }
-        if (ret > std::numeric_limits<I>::max() - digit) { return 0; }
-        if constexpr (std::numeric_limits<I>::is_signed) {
-            if (neg && ret < std::numeric_limits<I>::min() + digit) { return 0; }
-            ret += neg ? -digit : digit;
-        } else {
-            ret += digit;
-        }
-    }
-    success = true;
-    return ret;
+    I ret;
+    success = Numbers::parseInteger<I, BASE>(str.cstr(), str.byteLength(), ret);
+    return success ? ret : 0;
 }
 
 #define PGE_STRING_TO_FROM_SIGNED_INTEGER(TYPE) \
@@ -606,103 +703,45 @@ PGE_STRING_TO_FROM_UNSIGNED_INTEGER(unsigned long long)
 
 template <std::floating_point F>
 String String::fromFloatingPoint(F f) {
-    const char* format;
-    if constexpr (std::is_same<F, long double>::value) {
-        format = "%fL";
-    } else {
-        // floats are automatically promoted to double by printf
-        format = "%f";
-    }
-    
-    int size = snprintf(nullptr, 0, format, f);
-    char* buf; Metadata* retData;
-    String ret(size + 1, buf, retData);
-    snprintf(buf, size + 1, format, f);
-
-    retData->strByteLength = size;
-    retData->_strLength = size;
-
+    char digits[Numbers::MAX_FLOAT_LENGTH];
+    int size = Numbers::formatFloat(f, digits);
+    char* buf;
+    String ret(size, buf);
+    memcpy(buf, digits, size);
+    ret.setLengths(size, size);
     return ret;
 }
 
-static const String POSITIVE_INFINITY = "Inf";
-static const String NEGATIVE_INFINITY = '-' + POSITIVE_INFINITY;
-static const String POSITIVE_INFINITY_LONG = "Infinity";
-static const String NEGATIVE_INFINITY_LONG = '-' + POSITIVE_INFINITY_LONG;
-
-static const String NAN_STRING = "NaN";
-static const String NAN_STRING_LOWER = NAN_STRING.toLower();
-
-static constexpr char16 DECIMAL_SEPERATOR = L'.';
-
-template <std::floating_point F>
-static F toFloatingPoint(const String& str, bool& success) {
-    success = true;
-
-    // TODO: Move to end?
-    if (str.equalsIgnoreCase(NAN_STRING_LOWER)) {
-        return std::numeric_limits<F>::quiet_NaN();
-    }
+void String::FormatArg::setChar(char16 ch) {
+    text = StringView(digits, Unicode::wCharToUtf8(ch, digits));
+}
 
-    if (str.equalsIgnoreCase(POSITIVE_INFINITY)
-        || str.equalsIgnoreCase(POSITIVE_INFINITY_LONG)
-        || str.equalsIgnoreCase(L"\u221E")) {
-        return std::numeric_limits<F>::infinity();
-    }
+void String::FormatArg::setInteger(long long i) {
+    text = StringView(digits, (int)(std::to_chars(digits, digits + sizeof(digits), i).ptr - digits));
+}
 
-    if (str.equalsIgnoreCase(NEGATIVE_INFINITY)
-        || str.equalsIgnoreCase(NEGATIVE_INFINITY_LONG)
-        || str.equalsIgnoreCase(L"-\u221E")) {
-        return -std::numeric_limits<F>::infinity();
-    }
+void String::FormatArg::setInteger(unsigned long long i) {
+    text = StringView(digits, (int)(std::to_chars(digits, digits + sizeof(digits), i).ptr - digits));
+}
 
-    success = false;
-    F ret = 0;
-    String::Iterator it = str.begin();
-    bool neg = parseOptionalSign(it, str);
-
-    for (; it != str.end(); it++) {
-        char16 ch = *it;
-        if (ch == DECIMAL_SEPERATOR) { break; }
-        if (!Unicode::isDigit(ch)) { break; }
-        ret *= 10;
-        ret += (F)(ch - L'0');
-    }
+void String::FormatArg::setFloat(float f) {
+    static_assert(sizeof(digits) >= Numbers::MAX_FLOAT_LENGTH);
+    text = StringView(digits, Numbers::formatFloat(f, digits));
+}
 
-    if (it != str.end() && *it == DECIMAL_SEPERATOR) {
-        it++;
-        F multi = (F)1;
-        for (; it != str.end(); it++) {
-            multi /= 10;
-            char16 ch = *it;
-            if (!Unicode::isDigit(ch)) { break; }
-            ret += (F)(ch - L'0') * multi;
-        }
-    }
+void String::FormatArg::setFloat(double f) {
+    text = StringView(digits, Numbers::formatFloat(f, digits));
+}
 
-    if (it != str.end() && (*it == L'e' || *it == L'E')) {
-        it++;
-        using Exponent = u32; // TODO: Type.
-        Exponent exponent = 0;
-        bool expNeg = parseOptionalSign(it, str);
-        for (; it != str.end(); it++) {
-            char16 ch = *it;
-            if (!Unicode::isDigit(ch)) { return 0; }
-            if (exponent > std::numeric_limits<Exponent>::max() / 10) { return 0; }
-            exponent *= 10;
-            Exponent digit = (Exponent)(ch - L'0');
-            if (exponent > std::numeric_limits<Exponent>::max() - digit) { return 0; }
-            exponent += digit;
-        }
-        if (expNeg) {
-            ret = (F)(ret / pow(10, exponent));
-        } else {
-            ret = (F)(ret * pow(10, exponent));
-        }
-    }
+void String::FormatArg::setFloat(long double f) {
+    text = StringView(digits, Numbers::formatFloat(f, digits));
+}
 
-    success = true;
-    return neg ? -ret : ret;
+template <std::floating_point F>
+static F toFloatingPoint(const String& str, bool& success) {
+    F ret;
+    success = Numbers::parseFloat(str.cstr(), str.byteLength(), ret);
+    return success ? ret : 0;
 }
 
 #define PGE_STRING_TO_FLOAT(TYPE) \
@@ -714,28 +753,22 @@ PGE_STRING_TO_FLOAT(double)
 PGE_STRING_TO_FLOAT(long double)
 
 int String::length() const {
+    if (isShort()) {
+        return Unicode::countCodepoints(cstrBuf, shortData.byteLength);
+    }
     Metadata* data = getData();
-    if (data->_strLength < 0) {
-        if (std::holds_alternative<LiteralData>(internalData)) {
-            LiteralData& lit = std::get<LiteralData>(internalData);
-            if (std::holds_alternative<Metadata>(lit.data)) {
-                data = lit.shareData();
-                if (data->_strLength >= 0) {
-                    return data->_strLength;
-                }
-            }
-        }
-
-        const char* buf = cstr();
-        data->_strLength = 0;
-        for (int i = 0; buf[i] != '\0'; i += Unicode::measureCodepoint(buf[i])) {
-            data->_strLength++;
-        }
+    int len = data->_strLength.load();
+    if (len < 0) {
+        len = Unicode::countCodepoints(cstr(), byteLength());
+        data->_strLength.store(len);
     }
-    return data->_strLength;
+    return len;
 }
 
 int String::byteLength() const {
+    if (isShort()) {
+        return shortData.byteLength;
+    }
     Metadata* data = getData();
     PGE_ASSERT(data->strByteLength >= 0, "String byte length must always be valid");
     return data->strByteLength;
@@ -753,12 +786,10 @@ static const String EMPTY_FIND = "Find string can't be empty";
 
 String::Iterator String::findFirst(const String& fnd, const Iterator& from) const {
     if (fnd.isEmpty()) { return from; }
-    for (String::Iterator it = from; it.getBytePosition() <= byteLength() - fnd.byteLength(); it++) {
-        if (memcmp(fnd.cstr(), cstr() + it.getBytePosition(), fnd.byteLength()) == 0) {
-            return it;
-        }
-    }
-    return end();
+    int pos = Searcher(fnd.cstr(), fnd.byteLength()).findFirst(cstr(), byteLength(), from.getBytePosition());
+    if (pos < 0) { return end(); }
+    // The character position is only counted once it's asked for.
+    return Iterator(*this, pos, -1);
 }
 
 String::ReverseIterator String::findLast(const String& fnd, int fromEnd) const {
@@ -767,14 +798,10 @@ String::ReverseIterator String::findLast(const String& fnd, int fromEnd) const {
 
 String::ReverseIterator String::findLast(const String& fnd, const ReverseIterator& from) const {
     PGE_ASSERT(!fnd.isEmpty(), EMPTY_FIND);
-    String::ReverseIterator it = from;
-    while (it.getBytePosition() > byteLength() - fnd.byteLength()) {
-        it++;
-    }
-    for (; it != rend(); it++) {
-        if (memcmp(fnd.cstr(), cstr() + it.getBytePosition(), fnd.byteLength()) == 0) { return it; }
-    }
-    return rend();
+    if (from.getBytePosition() < 0) { return rend(); }
+    int pos = Searcher(fnd.cstr(), fnd.byteLength()).findLast(cstr(), byteLength(), from.getBytePosition());
+    if (pos < 0) { return rend(); }
+    return ReverseIterator(*this, pos, -1);
 }
 
 String String::substr(int start) const {
@@ -792,37 +819,36 @@ String String::substr(const Iterator& start) const {
 
 String String::substr(const Iterator& start, const Iterator& to) const {
     PGE_ASSERT(start.getBytePosition() <= to.getBytePosition(),
-        "start iterator can't come after to iterator (start: " + from(start.getBytePosition())
-        + "; to: " + from(to.getBytePosition()) + "; str: " + *this + ")");
+        concat("start iterator can't come after to iterator (start: ", from(start.getBytePosition()),
+            "; to: ", from(to.getBytePosition()), "; str: ", *this, ")"));
 
     int newSize = to.getBytePosition() - start.getBytePosition();
-    char* buf; Metadata* retData;
-    String ret(newSize, buf, retData);
-    retData->strByteLength = newSize;
-    // Due to not being friends with Iterators, we just bite the bullet here and hope for the best.
-    retData->_strLength = to.getPosition() - start.getPosition();
+    char* buf;
+    String ret(newSize, buf);
     memcpy(buf, cstr() + start.getBytePosition(), newSize);
-    buf[newSize] = '\0';
+    // Due to not being friends with Iterators, we just bite the bullet here and hope for the best.
+    ret.setLengths(newSize, to.getPosition() - start.getPosition());
     return ret;
 }
 
 String::Iterator String::charAt(int pos) const {
-    Iterator it;
-    for (it = begin(); it != end() && it.getPosition() != pos; it++);
-    return it;
+    if (pos < 0 || pos >= length()) { return end(); }
+    return Iterator(*this, getBytePosition(pos), pos);
 }
 
 String String::replace(const String& fnd, const String& rplace) const {
     std::vector<int> foundPositions;
-    for (String::Iterator it = findFirst(fnd); it != end(); it = findFirst(fnd, it + 1)) {
-        foundPositions.emplace_back(it.getBytePosition());
+    Searcher searcher(fnd.cstr(), fnd.byteLength());
+    for (int pos = searcher.findFirst(cstr(), byteLength(), 0); pos >= 0;) {
+        foundPositions.emplace_back(pos);
+        // An empty needle is found in front of every character and at the very end.
+        int next = fnd.isEmpty() ? pos + Unicode::measureCodepoint(cstr()[pos]) : pos + fnd.byteLength();
+        pos = searcher.findFirst(cstr(), byteLength(), next);
     }
-    if (fnd.isEmpty()) { foundPositions.emplace_back(byteLength()); }
     
     int newSize = byteLength() + (int)foundPositions.size() * (rplace.byteLength() - fnd.byteLength());
-    char* buf; Metadata* retData;
-    String ret(newSize, buf, retData);
-    retData->strByteLength = newSize;
+    char* buf;
+    String ret(newSize, buf);
 
     int retPos = 0;
     int thisPos = 0;
@@ -834,106 +860,108 @@ String String::replace(const String& fnd, const String& rplace) const {
         retPos += rplace.byteLength();
         thisPos = pos + fnd.byteLength();
     }
-    // Append the rest of the string, including terminating byte.
-    memcpy(buf + retPos, cstr() + thisPos, byteLength() - thisPos + 1);
-   
-    Metadata* data = getData();
+    // Append the rest of the string.
+    memcpy(buf + retPos, cstr() + thisPos, byteLength() - thisPos);
 
     // If the string that is being operated on already has had its length calculated, we assume it to be worth it to pre-calculate the new string's length.
-    if (data->_strLength >= 0) {
-        retData->_strLength = data->_strLength + (int)foundPositions.size() * (rplace.length() - fnd.length());
-    }
+    int len = knownLength();
+    ret.setLengths(newSize, len >= 0 ? len + (int)foundPositions.size() * (rplace.length() - fnd.length()) : -1);
     return ret;
 }
 
-char* String::getChars() const {
-    if (std::holds_alternative<StackAllocData>(internalData)) {
-        return std::get<StackAllocData>(internalData).cstrBuf;
-    } else if (std::holds_alternative<std::shared_ptr<HeapAllocData>>(internalData)) {
-        return std::get<std::shared_ptr<HeapAllocData>>(internalData)->cstrBuf.get();
-    } else {
-        return std::get<LiteralData>(internalData).cstrBuf;
-    }
-}
-
-String::Metadata* String::getData() const {
-    if (std::holds_alternative<StackAllocData>(internalData)) {
-        return &std::get<StackAllocData>(internalData).data;
-    } else if (std::holds_alternative<std::shared_ptr<HeapAllocData>>(internalData)) {
-        return &std::get<std::shared_ptr<HeapAllocData>>(internalData)->data;
-    } else {
-        return std::get<LiteralData>(internalData).getData();
+static std::unique_ptr<const std::vector<int>> buildCodepointIndex(const char* buf, int byteLength, int stride) {
+    std::unique_ptr<std::vector<int>> index = std::make_unique<std::vector<int>>();
+    int count = 0;
+    for (int i = 0; i < byteLength; i++) {
+        if ((buf[i] & 0b1100'0000) != 0b1000'0000) {
+            if (count != 0 && count % stride == 0) {
+                index->emplace_back(i);
+            }
+            count++;
+        }
     }
+    return index;
 }
 
-String::Metadata* String::LiteralData::shareData() {
-    static std::unordered_map<const char*, String::Metadata> litData;
-    static std::mutex litMut;
+int String::getBytePosition(int pos) const {
+    // Computing the length tells whether every byte is a codepoint.
+    int len = length();
+    if (len == byteLength()) { return pos; }
+    if (pos == len) { return byteLength(); }
 
-    Metadata* newData;
-    const auto& it = litData.find(cstrBuf);
-    if (it != litData.end()) {
-        newData = &it->second;
-    } else {
-        int litSize = getData()->strByteLength;
-        { // This needs to be synced.
-            std::lock_guard lock(litMut);
-            newData = &litData.emplace(
-                cstrBuf,
-                Metadata {
-                    .strByteLength = litSize,
-                }
-            ).first->second;
+    const char* buf = cstr();
+    int bytePos = 0;
+    int indexed = pos / CODEPOINT_INDEX_STRIDE;
+    // Only heap allocated strings are indexed, short ones are scanned quickly and literals have nowhere to keep the index.
+    Header* header = isShort() ? nullptr : longData.header;
+    if (indexed > 0 && header != nullptr) {
+        const std::vector<int>* index = header->codepointIndex.load(std::memory_order_acquire);
+        if (index == nullptr) {
+            const std::vector<int>* built = buildCodepointIndex(buf, byteLength(), CODEPOINT_INDEX_STRIDE).release();
+            // Another thread may have been faster, in which case its index is used and this one is discarded.
+            if (header->codepointIndex.compare_exchange_strong(index, built, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                index = built;
+            } else {
+                delete built;
+            }
         }
+        bytePos = (*index)[indexed - 1];
+    } else {
+        indexed = 0;
+    }
+    // Less than a stride remains.
+    for (int i = indexed * CODEPOINT_INDEX_STRIDE; i < pos; i++) {
+        do { bytePos++; } while ((buf[bytePos] & 0b1100'0000) == 0b1000'0000);
     }
-    return data.emplace<Metadata*>(newData);
+    return bytePos;
 }
 
 // TODO: Funny special cases!
-String String::performCaseConversion(const std::function<void (String&, char16)>& func) const {
-    char* buf; Metadata* retData;
-    String ret(byteLength(), buf, retData);
-    retData->strByteLength = 0;
-    retData->_strLength = 0;
-    for (char16 ch : *this) {
-        func(ret, ch);
+String String::performCaseConversion(char asciiFrom, void (*func)(StringBuilder&, char16)) const {
+    const char* buf = cstr();
+    int len = byteLength();
+    // Most conversions keep the byte length, so this usually ends up being the only allocation.
+    StringBuilder builder(len);
+    int i = 0;
+    while (i < len) {
+        if (len - i >= Simd::BLOCK_SIZE && Simd::isAsciiBlock(buf + i)) {
+            Simd::flipAsciiCaseBlock(buf + i, builder.appendUninitialized(Simd::BLOCK_SIZE, Simd::BLOCK_SIZE), asciiFrom);
+            i += Simd::BLOCK_SIZE;
+        } else if ((buf[i] & 0x80) == 0) {
+            builder.appendByte((u8)(buf[i] - asciiFrom) < 26 ? buf[i] ^ 0x20 : buf[i]);
+            i++;
+        } else {
+            int codepoint = Unicode::measureCodepoint(buf[i]);
+            func(builder, Unicode::utf8ToWChar(buf + i, codepoint));
+            i += codepoint;
+        }
     }
-    return ret;
+    return builder.build();
 }
 
 String String::toUpper() const {
-    return performCaseConversion(Unicode::up);
+    return performCaseConversion('a', Unicode::up);
 }
 
 String String::toLower() const {
-    return performCaseConversion(Unicode::down);
+    return performCaseConversion('A', Unicode::down);
 }
 
-String String::trim() const {
-    if (isEmpty()) { return *this; }
-
-    int newLen = getData()->_strLength;
-    Iterator leading = begin();
-    while (leading != end() && Unicode::isSpace(*leading)) {
-        leading++; newLen--;
-    }
-    if (leading == end()) {
-        return String();
-    }
-
-    ReverseIterator trailing = rbegin();
-    while (Unicode::isSpace(*trailing)) { trailing++; newLen--; }
+String String::foldCase() const {
+    return performCaseConversion('A', Unicode::fold);
+}
 
-    String ret(*this, leading.getBytePosition(), trailing.getBytePosition() - leading.getBytePosition() + 1);
-    ret.getData()->_strLength = newLen;
-    return ret;
+String String::trim() const {
+    StringView trimmed = trimView();
+    // Nothing to trim, so the data can be shared.
+    if (trimmed.byteLength() == byteLength()) { return *this; }
+    return String(trimmed);
 }
 
 String String::reverse() const {
     int len = byteLength();
-    char* buf; Metadata* retData;
-    String ret(len, buf, retData);
-    buf[len] = '\0';
+    char* buf;
+    String ret(len, buf);
     buf += len;
     for (int i = 0; i < len;) {
         int codepoint = Unicode::measureCodepoint(cstr()[i]);
@@ -941,8 +969,7 @@ String String::reverse() const {
         memcpy(buf, cstr() + i, codepoint);
         i += codepoint;
     }
-    retData->strByteLength = len;
-    retData->_strLength = getData()->_strLength;
+    ret.setLengths(len, knownLength());
     return ret;
 }
 
@@ -952,9 +979,8 @@ String String::repeat(int count, const String& separator) const {
     int curLength = byteLength();
     int sepLength = separator.byteLength();
     int newSize = curLength * count + sepLength * (count - 1);
-    char* buf; Metadata* retData;
-    String ret(newSize, buf, retData);
-    buf[newSize] = '\0';
+    char* buf;
+    String ret(newSize, buf);
     for (int i : Range(count)) {
         if (i != 0) {
             memcpy(buf, separator.cstr(), sepLength);
@@ -963,52 +989,65 @@ String String::repeat(int count, const String& separator) const {
         memcpy(buf, cstr(), curLength);
         buf += curLength;
     }
-    retData->strByteLength = newSize;
-    if (getData()->_strLength >= 0) { retData->_strLength = length() * count + separator.length() * (count - 1); }
+    ret.setLengths(newSize, knownLength() >= 0 ? length() * count + separator.length() * (count - 1) : -1);
     return ret;
 }
 
 std::vector<String> String::split(const String& needleStr, bool removeEmptyEntries) const {
+    std::vector<StringView> views = splitView(needleStr, removeEmptyEntries);
     std::vector<String> split;
-    const char* haystack = cstr();
-    int codepoint;
-    int needleLen = needleStr.byteLength();
-    int cut = 0;
-    for (int i = 0; i <= byteLength() - needleLen;) {
-        codepoint = Unicode::measureCodepoint(haystack[i]);
-        if (needleStr.isEmpty() || memcmp(haystack + i, needleStr.cstr(), needleLen) == 0) {
-            int addSize = i - cut;
-            if (addSize > 0) {
-                split.emplace_back(String(*this, cut, addSize));
-            } else if (!removeEmptyEntries) {
-                split.emplace_back();
-            }
-            cut = i + needleLen;
-            if (needleLen > codepoint) {
-                i += needleLen;
-                continue;
-            }
-        }
-        i += codepoint;
-    }
-    // Add the rest of the string to the vector.
-    int endAddSize = byteLength() - cut;
-    if (!removeEmptyEntries || endAddSize > 0) {
-        split.emplace_back(String(*this, cut, endAddSize));
+    split.reserve(views.size());
+    for (const StringView& view : views) {
+        split.emplace_back(view);
     }
     return split;
 }
 
+StringView String::substrView(int start) const {
+    return StringView(*this).substr(start);
+}
+
+StringView String::substrView(int start, int cnt) const {
+    return StringView(*this).substr(start, cnt);
+}
+
+StringView String::trimView() const {
+    return StringView(*this).trim();
+}
+
+std::vector<StringView> String::splitView(const StringView& needle, bool removeEmptyEntries) const {
+    return StringView(*this).split(needle, removeEmptyEntries);
+}
+
+// Patterns tend to be matched over and over, so the most recently used ones are kept compiled.
+// Per thread, as matching a Regex isn't thread-safe.
+struct RegexCache {
+    static constexpr int CAPACITY = 8;
+
+    // Most recently used first.
+    std::vector<std::pair<String, Regex>> entries;
+
+    static const Regex& get(const String& pattern) {
+        static thread_local RegexCache cache;
+        std::vector<std::pair<String, Regex>>& entries = cache.entries;
+        for (auto it = entries.begin(); it != entries.end(); it++) {
+            if (it->first == pattern) {
+                std::rotate(entries.begin(), it, it + 1);
+                return entries.front().second;
+            }
+        }
+        Regex regex(pattern);
+        if (entries.size() == CAPACITY) {
+            entries.pop_back();
+        }
+        entries.emplace(entries.begin(), pattern, std::move(regex));
+        return entries.front().second;
+    }
+};
+
 String String::regexMatch(const String& pattern) const {
-    // TODO: C++23 will add support for char8_t and/or deprecate std::regex
-    // We will have to react accordingly. Perhaps implementing our own regex matcher.
-    std::vector<char16> s = wstr();
-    std::wcmatch m;
-    std::regex_search(s.data(), m, std::wregex(pattern.wstr().data()));
-
-    s[m.position() + m.length()] = '\0';
-    String ret(s.data() + m.position());
-    return ret;
+    std::optional<StringView> match = RegexCache::get(pattern).find(*this);
+    return match.has_value() ? match->str() : String();
 }
 
 /* TODO: Improve this if we get MacOS support back. Non-fixed return value size and possibly propagating more metadata.
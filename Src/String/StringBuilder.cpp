@@ -0,0 +1,146 @@
+#include <PGE/String/StringBuilder.h>
+#include <PGE/String/Unicode.h>
+
+#include <limits>
+#include <memory>
+
+#include <PGE/Exception/Exception.h>
+
+#include "UnicodeHelper.h"
+
+using namespace PGE;
+
+StringBuilder::StringBuilder(int byteCapacity) {
+    reserve(byteCapacity);
+}
+
+StringBuilder::StringBuilder(String&& str) {
+    if (!str.isShort() && str.longData.header != nullptr && str.longData.header->refCount.load(std::memory_order_acquire) == 1) {
+        strLength = str.length();
+        strByteLength = str.byteLength();
+        // The reference is taken over, str is left empty.
+        buffer.reset(str.longData.header);
+        str.shortData = { };
+        str.cstrBuf = str.shortData.chars;
+        return;
+    }
+    append(str);
+}
+
+void StringBuilder::reserve(int byteCapacity) {
+    // Accounting for the terminating byte.
+    if (byteCapacity + 1 > getCapacity()) {
+        resize(byteCapacity + 1);
+    }
+}
+
+int StringBuilder::getCapacity() const {
+    return buffer != nullptr ? buffer->capacity : 0;
+}
+
+void StringBuilder::makeSpace(int additionalBytes) {
+    int capacity = getCapacity();
+    int required = strByteLength + additionalBytes + 1;
+    if (required > capacity) {
+        PGE_ASSERT(required > strByteLength, "Max string length exceeded!");
+        int grown = capacity > std::numeric_limits<int>::max() / 2 ? std::numeric_limits<int>::max() : capacity * 2;
+        resize(std::max(required, std::max(grown, MIN_CAPACITY)));
+    }
+}
+
+void StringBuilder::resize(int newCapacity) {
+    // The capacity ends up rounded up to fill the whole allocation.
+    String::Header* newBuffer = String::Header::allocate(newCapacity);
+    if (strByteLength > 0) {
+        memcpy(newBuffer->chars(), buffer->chars(), strByteLength);
+    }
+    buffer.reset(newBuffer);
+}
+
+void StringBuilder::append(const String& str) {
+    int len = str.byteLength();
+    makeSpace(len);
+    memcpy(buffer->chars() + strByteLength, str.cstr(), len);
+    strByteLength += len;
+    strLength += str.length();
+}
+
+void StringBuilder::append(char16 ch) {
+    makeSpace(4);
+    strByteLength += Unicode::wCharToUtf8(ch, buffer->chars() + strByteLength);
+    strLength++;
+}
+
+void StringBuilder::appendUtf16(std::span<const char16> units) {
+    int byteCount = Unicode::measureUtf8(units);
+    makeSpace(byteCount);
+    // Transcoding throws on units that aren't valid characters, the lengths are only updated once it succeeded.
+    Unicode::utf16ToUtf8(units, std::span<char>(buffer->chars() + strByteLength, byteCount));
+    strByteLength += byteCount;
+    strLength += (int)units.size();
+}
+
+void StringBuilder::appendBytes(std::span<const char> bytes) {
+    int len = (int)bytes.size();
+    makeSpace(len);
+    memcpy(buffer->chars() + strByteLength, bytes.data(), len);
+    strLength += Unicode::countCodepoints(buffer->chars() + strByteLength, len);
+    strByteLength += len;
+}
+
+void StringBuilder::appendBytes(std::span<const char> bytes, int codepointCount) {
+    memcpy(appendUninitialized((int)bytes.size(), codepointCount), bytes.data(), bytes.size());
+}
+
+void StringBuilder::appendByte(char ch) {
+    makeSpace(1);
+    buffer->chars()[strByteLength] = ch;
+    strByteLength++;
+    strLength += (ch & 0b1100'0000) != 0b1000'0000;
+}
+
+char* StringBuilder::appendUninitialized(int byteCount, int codepointCount) {
+    makeSpace(byteCount);
+    char* ret = buffer->chars() + strByteLength;
+    strByteLength += byteCount;
+    strLength += codepointCount;
+    return ret;
+}
+
+const char* StringBuilder::data() const {
+    return buffer != nullptr ? buffer->chars() : nullptr;
+}
+
+int StringBuilder::byteLength() const {
+    return strByteLength;
+}
+
+int StringBuilder::length() const {
+    return strLength;
+}
+
+bool StringBuilder::isEmpty() const {
+    return strByteLength == 0;
+}
+
+void StringBuilder::clear() {
+    strByteLength = 0;
+    strLength = 0;
+}
+
+String StringBuilder::build() {
+    if (strByteLength == 0) {
+        return String();
+    }
+
+    String ret;
+    if (strByteLength + 1 <= String::SHORT_STR_CAPACITY) {
+        memcpy(ret.reallocate(strByteLength), buffer->chars(), strByteLength);
+    } else {
+        std::construct_at(&ret.longData, String::LongData { .header = buffer.release(), .data = { } });
+        ret.cstrBuf = ret.longData.header->chars();
+    }
+    ret.setLengths(strByteLength, strLength);
+    clear();
+    return ret;
+}
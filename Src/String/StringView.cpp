@@ -0,0 +1,212 @@
+#include <PGE/String/StringView.h>
+
+#include <PGE/String/String.h>
+#include <PGE/String/Unicode.h>
+#include <PGE/Exception/Exception.h>
+#include <PGE/Math/Hasher.h>
+
+#include "UnicodeHelper.h"
+#include "SearchHelper.h"
+
+using namespace PGE;
+
+//
+// Iterator
+//
+
+StringView::Iterator::Iterator(const StringView& view, int byteIndex, int chIndex)
+    : buf(view.buf), bufLength(view.bufLength), index(byteIndex), charIndex(chIndex) { }
+
+char16 StringView::Iterator::operator*() const {
+    PGE_ASSERT(index >= 0 && index < bufLength, "Tried dereferencing invalid iterator");
+    if (_ch == L'\uFFFF') {
+        _ch = Unicode::utf8ToWChar(buf + index, Unicode::measureCodepoint(buf[index]));
+    }
+    return _ch;
+}
+
+StringView::Iterator& StringView::Iterator::operator++() {
+    PGE_ASSERT(index < bufLength, "Tried incrementing end iterator");
+    index += Unicode::measureCodepoint(buf[index]);
+    _ch = L'\uFFFF';
+    if (charIndex >= 0) { charIndex++; }
+    return *this;
+}
+
+StringView::Iterator& StringView::Iterator::operator--() {
+    PGE_ASSERT(index > 0, "Tried decrementing begin iterator");
+    index--;
+    while ((buf[index] & 0b1100'0000) == 0b1000'0000) {
+        index--;
+    }
+    _ch = L'\uFFFF';
+    if (charIndex >= 0) { charIndex--; }
+    return *this;
+}
+
+void StringView::Iterator::operator+=(int steps) {
+    if (steps < 0) { *this -= -steps; return; }
+    for (PGE_IT : Range(steps)) {
+        ++(*this);
+    }
+}
+
+void StringView::Iterator::operator-=(int steps) {
+    if (steps < 0) { *this += -steps; return; }
+    for (PGE_IT : Range(steps)) {
+        --(*this);
+    }
+}
+
+int StringView::Iterator::operator-(const Iterator& other) const {
+    return getPosition() - other.getPosition();
+}
+
+bool StringView::Iterator::operator==(const Iterator& other) const {
+    return buf == other.buf && index == other.index;
+}
+
+int StringView::Iterator::getBytePosition() const {
+    return index;
+}
+
+int StringView::Iterator::getPosition() const {
+    if (charIndex < 0) {
+        charIndex = Unicode::countCodepoints(buf, index);
+    }
+    return charIndex;
+}
+
+//
+
+StringView::StringView(const String& str)
+    : buf(str.cstr()), bufLength(str.byteLength()), _strLength(str.knownLength()) { }
+
+StringView::StringView(const char* bytes, int byteCount)
+    : buf(bytes), bufLength(byteCount), _strLength(-1) {
+    PGE_ASSERT(byteCount >= 0, "View length must be non-negative");
+}
+
+StringView::Iterator StringView::begin() const {
+    return Iterator(*this, 0, 0);
+}
+
+StringView::Iterator StringView::end() const {
+    return Iterator(*this, bufLength, _strLength);
+}
+
+int StringView::length() const {
+    if (_strLength < 0) {
+        _strLength = Unicode::countCodepoints(buf, bufLength);
+    }
+    return _strLength;
+}
+
+bool StringView::contains(const StringView& fnd) const {
+    return findFirst(fnd) != end();
+}
+
+StringView::Iterator StringView::findFirst(const StringView& fnd, int from) const {
+    return findFirst(fnd, begin() + from);
+}
+
+StringView::Iterator StringView::findFirst(const StringView& fnd, const Iterator& from) const {
+    if (fnd.isEmpty()) { return from; }
+    int pos = Searcher(fnd.buf, fnd.bufLength).findFirst(buf, bufLength, from.getBytePosition());
+    if (pos < 0) { return end(); }
+    return Iterator(*this, pos, -1);
+}
+
+StringView::Iterator StringView::findLast(const StringView& fnd) const {
+    int pos = Searcher(fnd.buf, fnd.bufLength).findLast(buf, bufLength, bufLength);
+    if (pos < 0) { return end(); }
+    return Iterator(*this, pos, -1);
+}
+
+StringView StringView::substr(int start) const {
+    return substr(begin() + start);
+}
+
+StringView StringView::substr(int start, int cnt) const {
+    Iterator from = begin() + start;
+    return substr(from, from + cnt);
+}
+
+StringView StringView::substr(const Iterator& start) const {
+    return substr(start, end());
+}
+
+StringView StringView::substr(const Iterator& start, const Iterator& to) const {
+    PGE_ASSERT(start.getBytePosition() <= to.getBytePosition(), "start iterator can't come after to iterator");
+    StringView ret(buf + start.getBytePosition(), to.getBytePosition() - start.getBytePosition());
+    if (start.charIndex >= 0 && to.charIndex >= 0) {
+        ret._strLength = to.charIndex - start.charIndex;
+    }
+    return ret;
+}
+
+StringView StringView::trim() const {
+    Iterator leading = begin();
+    while (leading != end() && Unicode::isSpace(*leading)) {
+        leading++;
+    }
+    if (leading == end()) {
+        return StringView(buf + bufLength, 0);
+    }
+
+    Iterator trailing = end();
+    do { trailing--; } while (Unicode::isSpace(*trailing));
+    trailing++;
+    return substr(leading, trailing);
+}
+
+std::vector<StringView> StringView::split(const StringView& needle, bool removeEmptyEntries) const {
+    std::vector<StringView> split;
+    Searcher searcher(needle.buf, needle.bufLength);
+    int cut = 0;
+    for (int pos = searcher.findFirst(buf, bufLength, 0); pos >= 0;) {
+        int addSize = pos - cut;
+        if (addSize > 0) {
+            split.emplace_back(buf + cut, addSize);
+        } else if (!removeEmptyEntries) {
+            split.emplace_back(buf + cut, 0);
+        }
+        cut = pos + needle.bufLength;
+        // An empty needle is found in front of every character and at the very end.
+        // The view doesn't necessarily end on a null byte, so the end is stepped over by hand.
+        int next = !needle.isEmpty() ? cut : pos < bufLength ? pos + Unicode::measureCodepoint(buf[pos]) : pos + 1;
+        pos = searcher.findFirst(buf, bufLength, next);
+    }
+    // Add the rest of the view.
+    int endAddSize = bufLength - cut;
+    if (!removeEmptyEntries || endAddSize > 0) {
+        split.emplace_back(buf + cut, endAddSize);
+    }
+    return split;
+}
+
+u64 StringView::getHashCode() const {
+    return Hasher::getHash(std::span((const byte*)buf, bufLength));
+}
+
+// Byte-wise order of UTF-8 is the same as the order of the codepoints.
+std::weak_ordering StringView::compare(const StringView& other) const {
+    int cmp = memcmp(buf, other.buf, std::min(bufLength, other.bufLength));
+    if (cmp != 0) {
+        return cmp < 0 ? std::weak_ordering::less : std::weak_ordering::greater;
+    }
+    return bufLength <=> other.bufLength;
+}
+
+bool StringView::equals(const StringView& other) const {
+    if (bufLength != other.bufLength) { return false; }
+    return buf == other.buf || memcmp(buf, other.buf, bufLength) == 0;
+}
+
+String StringView::str() const {
+    return String(*this);
+}
+
+bool PGE::operator==(const StringView& a, const StringView& b) {
+    return a.equals(b);
+}
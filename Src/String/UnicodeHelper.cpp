@@ -1,4 +1,9 @@
 #include "UnicodeHelper.h"
+#include "SimdHelper.h"
+
+#include <PGE/String/Unicode.h>
+
+#include <algorithm>
 
 #include <PGE/Exception/Exception.h>
 
@@ -46,49 +51,333 @@ char16 Unicode::utf8ToWChar(const char* cbuffer, int codepointLen) {
 byte Unicode::wCharToUtf8(char16 chr, char* result) {
     assertChar(chr);
 
-    // Fits in standard ASCII, just return the char as-is.
-    if ((chr & 0x7f) == chr) {
+    if (chr < 0x80) {
         if (result != nullptr) { result[0] = (char)chr; }
         return 1;
     }
+    if (chr < 0x800) {
+        if (result != nullptr) {
+            result[0] = (char)(0xC0 | (chr >> 6));
+            result[1] = (char)(0x80 | (chr & 0x3F));
+        }
+        return 2;
+    }
+    if (result != nullptr) {
+        result[0] = (char)(0xE0 | (chr >> 12));
+        result[1] = (char)(0x80 | ((chr >> 6) & 0x3F));
+        result[2] = (char)(0x80 | (chr & 0x3F));
+    }
+    return 3;
+}
 
-    byte len = 1;
+// Continuation bytes (0b10xxxxxx) are exactly the bytes less than or equal to 0xBF when interpreted as signed.
+static constexpr char LAST_CONTINUATION_BYTE = (char)0xBF;
 
-    // Determine most of the bytes after the first one.
-    while ((chr & (~0x3f)) != 0x00) {
-        if (result != nullptr) { result[len - 1] = 0x80 | (chr & 0x3f); }
-        chr >>= 6;
-        len++;
-    }
+static bool isContinuationByte(char chr) {
+    return (chr & 0b1100'0000) == 0b1000'0000;
+}
 
-    // Determine the remaining byte(s): if the number of free bits in
-    // the first byte isn't enough to fit the remaining bits,
-    // add another byte.
-    char firstByte = 0x00;
-    for (int i : Range(len)) {
-        firstByte |= (0x1 << (7 - i));
+int Unicode::countCodepoints(const char* buf, int byteLength) {
+    int count = 0;
+    int i = 0;
+#ifdef PGE_SIMD
+    // The per-lane counters are 8 bits wide and need to be flushed before they can overflow.
+    constexpr int MAX_BLOCKS_PER_FLUSH = 255;
+    while (byteLength - i >= Simd::BLOCK_SIZE) {
+        int blocks = std::min((byteLength - i) / Simd::BLOCK_SIZE, MAX_BLOCKS_PER_FLUSH);
+#if defined(PGE_SIMD_AVX2)
+        const __m256i threshold = _mm256_set1_epi8(LAST_CONTINUATION_BYTE);
+        __m256i counters = _mm256_setzero_si256();
+        for (PGE_IT : Range(blocks)) {
+            __m256i chunk = _mm256_loadu_si256((const __m256i*)(buf + i));
+            // Lanes of non-continuation bytes are set to -1.
+            counters = _mm256_sub_epi8(counters, _mm256_cmpgt_epi8(chunk, threshold));
+            i += Simd::BLOCK_SIZE;
+        }
+        alignas(32) u64 sums[4];
+        _mm256_store_si256((__m256i*)sums, _mm256_sad_epu8(counters, _mm256_setzero_si256()));
+        count += (int)(sums[0] + sums[1] + sums[2] + sums[3]);
+#elif defined(PGE_SIMD_SSE2)
+        const __m128i threshold = _mm_set1_epi8(LAST_CONTINUATION_BYTE);
+        __m128i counters = _mm_setzero_si128();
+        for (PGE_IT : Range(blocks)) {
+            __m128i chunk = _mm_loadu_si128((const __m128i*)(buf + i));
+            counters = _mm_sub_epi8(counters, _mm_cmpgt_epi8(chunk, threshold));
+            i += Simd::BLOCK_SIZE;
+        }
+        __m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+        count += _mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+#else
+        const int8x16_t threshold = vdupq_n_s8(LAST_CONTINUATION_BYTE);
+        uint8x16_t counters = vdupq_n_u8(0);
+        for (PGE_IT : Range(blocks)) {
+            int8x16_t chunk = vld1q_s8((const i8*)(buf + i));
+            counters = vsubq_u8(counters, vcgtq_s8(chunk, threshold));
+            i += Simd::BLOCK_SIZE;
+        }
+        count += vaddlvq_u8(counters);
+#endif
     }
+#endif
+    for (; i < byteLength; i++) {
+        if (!isContinuationByte(buf[i])) {
+            count++;
+        }
+    }
+    return count;
+}
 
-    if (((firstByte | (0x1 << (7 - len))) & chr) == 0x00) {
-        // It fits!
-        firstByte |= chr;
+// Returns the length of the well-formed sequence starting at buf or 0 if it is malformed.
+static int validateCodepoint(const byte* buf, int remaining) {
+    byte lead = buf[0];
+    if (lead < 0x80) { return 1; }
+
+    int len;
+    // The second byte's range is narrowed to exclude overlong encodings, surrogates and codepoints above U+10FFFF.
+    byte secondMin = 0x80;
+    byte secondMax = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        len = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        len = 3;
+        if (lead == 0xE0) { secondMin = 0xA0; }
+        else if (lead == 0xED) { secondMax = 0x9F; }
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        len = 4;
+        if (lead == 0xF0) { secondMin = 0x90; }
+        else if (lead == 0xF4) { secondMax = 0x8F; }
     } else {
-        // It doesn't fit: add another byte.
-        if (result != nullptr) { result[len - 1] = 0x80 | (chr & 0x3f); }
-        chr >>= 6;
-        firstByte = (char)((firstByte | (0x1 << (7 - len))) | chr);
-        len++;
+        return 0;
     }
 
-    if (result != nullptr) {
-        result[len - 1] = firstByte;
-        // Flip the result.
-        for (int i : Range(len / 2)) {
-            char b = result[i];
-            result[i] = result[len - 1 - i];
-            result[len - 1 - i] = b;
+    if (remaining < len) { return 0; }
+    if (buf[1] < secondMin || buf[1] > secondMax) { return 0; }
+    for (int i : Range(2, len)) {
+        if (!isContinuationByte((char)buf[i])) { return 0; }
+    }
+    return len;
+}
+
+bool Unicode::validateAndCount(const char* buf, int byteLength, int& count) {
+    count = 0;
+    int i = 0;
+    while (i < byteLength) {
+        int blockEnd = i + Simd::BLOCK_SIZE;
+        if (blockEnd <= byteLength && Simd::isAsciiBlock(buf + i)) {
+            count += Simd::BLOCK_SIZE;
+            i = blockEnd;
+            continue;
+        }
+
+        // Mixed block, the last sequence is allowed to reach into the next block.
+        blockEnd = std::min(blockEnd, byteLength);
+        while (i < blockEnd) {
+            int len = validateCodepoint((const byte*)buf + i, byteLength - i);
+            if (len == 0) { return false; }
+            i += len;
+            count++;
         }
     }
+    return true;
+}
 
-    return len;
+int Unicode::measureUtf8(std::span<const char16> utf16) {
+    const char16* src = utf16.data();
+    int count = (int)utf16.size();
+    int bytes = 0;
+    int i = 0;
+    // Every unit takes three bytes, minus one for units below 0x800 and another one for units below 0x80.
+#if defined(PGE_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    while (count - i >= 8) {
+        // The comparisons yield -1 per lane, which is counted per lane and summed up before the 16-bit lanes can overflow.
+        __m128i shorter = zero;
+        int blocksEnd = i + std::min((count - i) / 8, 8192) * 8;
+        bytes += (blocksEnd - i) * 3;
+        for (; i < blocksEnd; i += 8) {
+            __m128i units = _mm_loadu_si128((const __m128i*)(src + i));
+            shorter = _mm_sub_epi16(shorter, _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short)0xFF80)), zero));
+            shorter = _mm_sub_epi16(shorter, _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short)0xF800)), zero));
+        }
+        __m128i sums = _mm_madd_epi16(shorter, _mm_set1_epi16(1));
+        sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(1, 0, 3, 2)));
+        sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(2, 3, 0, 1)));
+        bytes -= _mm_cvtsi128_si32(sums);
+    }
+#elif defined(PGE_SIMD_NEON)
+    for (; count - i >= 8; i += 8) {
+        uint16x8_t units = vld1q_u16((const u16*)(src + i));
+        uint16x8_t below80 = vshrq_n_u16(vcltq_u16(units, vdupq_n_u16(0x80)), 15);
+        uint16x8_t below800 = vshrq_n_u16(vcltq_u16(units, vdupq_n_u16(0x800)), 15);
+        bytes += 24 - vaddvq_u16(vaddq_u16(below80, below800));
+    }
+#endif
+    for (; i < count; i++) {
+        bytes += 3 - (src[i] < 0x80) - (src[i] < 0x800);
+    }
+    return bytes;
+}
+
+int Unicode::utf16ToUtf8(std::span<const char16> utf16, std::span<char> utf8) {
+    const char16* src = utf16.data();
+    int count = (int)utf16.size();
+    char* dst = utf8.data();
+    char* dstEnd = utf8.data() + utf8.size();
+    int i = 0;
+#if defined(PGE_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    while (count - i >= 8) {
+        __m128i units = _mm_loadu_si128((const __m128i*)(src + i));
+        int below80 = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short)0xFF80)), zero));
+        int below800 = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short)0xF800)), zero));
+        // Null characters, 0xFFFE and 0xFFFF are left to the scalar path to be reported.
+        int invalid = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(units, zero),
+            _mm_cmpeq_epi16(_mm_or_si128(units, _mm_set1_epi16(1)), _mm_set1_epi16(-1))));
+        if (invalid == 0 && below80 == 0xFFFF) {
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(units, units));
+            dst += 8;
+            i += 8;
+            continue;
+        }
+        if (below80 == 0 && below800 == 0xFFFF) {
+            // 110xxxxx 10xxxxxx, the lead byte comes first and therefore goes into the lower half of each lane.
+            __m128i lead = _mm_or_si128(_mm_srli_epi16(units, 6), _mm_set1_epi16(0xC0));
+            __m128i continuation = _mm_or_si128(_mm_and_si128(units, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+            _mm_storeu_si128((__m128i*)dst, _mm_or_si128(lead, _mm_slli_epi16(continuation, 8)));
+            dst += 16;
+            i += 8;
+            continue;
+        }
+        if (invalid == 0 && below800 == 0 && dstEnd - dst >= 32) {
+            // 1110xxxx 10xxxxxx 10xxxxxx, built in 32-bit lanes.
+            // Each lane is stored as a whole, its fourth byte is overwritten by the next one.
+            alignas(16) u32 lanes[8];
+            for (int half = 0; half < 2; half++) {
+                __m128i wide = half == 0 ? _mm_unpacklo_epi16(units, zero) : _mm_unpackhi_epi16(units, zero);
+                __m128i lead = _mm_or_si128(_mm_srli_epi32(wide, 12), _mm_set1_epi32(0xE0));
+                __m128i middle = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(wide, 6), _mm_set1_epi32(0x3F)), _mm_set1_epi32(0x80));
+                __m128i last = _mm_or_si128(_mm_and_si128(wide, _mm_set1_epi32(0x3F)), _mm_set1_epi32(0x80));
+                __m128i packed = _mm_or_si128(lead, _mm_or_si128(_mm_slli_epi32(middle, 8), _mm_slli_epi32(last, 16)));
+                _mm_store_si128((__m128i*)(lanes + half * 4), packed);
+            }
+            for (int j = 0; j < 8; j++) {
+                memcpy(dst + j * 3, lanes + j, sizeof(u32));
+            }
+            dst += 24;
+            i += 8;
+            continue;
+        }
+        // Mixed lengths, the block is encoded one unit at a time.
+        for (int end = i + 8; i < end; i++) {
+            dst += wCharToUtf8(src[i], dst);
+        }
+    }
+#elif defined(PGE_SIMD_NEON)
+    while (count - i >= 8) {
+        uint16x8_t units = vld1q_u16((const u16*)(src + i));
+        u16 min = vminvq_u16(units);
+        u16 max = vmaxvq_u16(units);
+        // Null characters, 0xFFFE and 0xFFFF are left to the scalar path to be reported.
+        if (min != 0 && max < 0x80) {
+            vst1_u8((u8*)dst, vmovn_u16(units));
+            dst += 8;
+            i += 8;
+            continue;
+        }
+        if (min >= 0x80 && max < 0x800) {
+            // 110xxxxx 10xxxxxx, the lead byte comes first and therefore goes into the lower half of each lane.
+            uint16x8_t lead = vorrq_u16(vshrq_n_u16(units, 6), vdupq_n_u16(0xC0));
+            uint16x8_t continuation = vorrq_u16(vandq_u16(units, vdupq_n_u16(0x3F)), vdupq_n_u16(0x80));
+            vst1q_u8((u8*)dst, vreinterpretq_u8_u16(vorrq_u16(lead, vshlq_n_u16(continuation, 8))));
+            dst += 16;
+            i += 8;
+            continue;
+        }
+        if (min >= 0x800 && max < 0xFFFE) {
+            // 1110xxxx 10xxxxxx 10xxxxxx, interleaved by the store.
+            uint8x8x3_t bytes;
+            bytes.val[0] = vmovn_u16(vorrq_u16(vshrq_n_u16(units, 12), vdupq_n_u16(0xE0)));
+            bytes.val[1] = vmovn_u16(vorrq_u16(vandq_u16(vshrq_n_u16(units, 6), vdupq_n_u16(0x3F)), vdupq_n_u16(0x80)));
+            bytes.val[2] = vmovn_u16(vorrq_u16(vandq_u16(units, vdupq_n_u16(0x3F)), vdupq_n_u16(0x80)));
+            vst3_u8((u8*)dst, bytes);
+            dst += 24;
+            i += 8;
+            continue;
+        }
+        for (int end = i + 8; i < end; i++) {
+            dst += wCharToUtf8(src[i], dst);
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        dst += wCharToUtf8(src[i], dst);
+    }
+    return (int)(dst - utf8.data());
+}
+
+int Unicode::utf8ToUtf16(std::span<const char> utf8, std::span<char16> utf16) {
+    const char* src = utf8.data();
+    int length = (int)utf8.size();
+    char16* dst = utf16.data();
+    int i = 0;
+#if defined(PGE_SIMD_SSE2) || defined(PGE_SIMD_NEON)
+    while (length - i >= 16) {
+#if defined(PGE_SIMD_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(src + i));
+        int nonAscii = _mm_movemask_epi8(chunk);
+        if (nonAscii == 0) {
+            _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi8(chunk, zero));
+            _mm_storeu_si128((__m128i*)(dst + 8), _mm_unpackhi_epi8(chunk, zero));
+            dst += 16;
+            i += 16;
+            continue;
+        }
+        // Eight 2-byte sequences, with the lead bytes in the lower halves of the lanes.
+        __m128i pattern = _mm_and_si128(chunk, _mm_set1_epi16((short)0xC0E0));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(pattern, _mm_set1_epi16((short)0x80C0))) == 0xFFFF) {
+            __m128i lead = _mm_and_si128(chunk, _mm_set1_epi16(0x1F));
+            __m128i continuation = _mm_and_si128(_mm_srli_epi16(chunk, 8), _mm_set1_epi16(0x3F));
+            _mm_storeu_si128((__m128i*)dst, _mm_or_si128(_mm_slli_epi16(lead, 6), continuation));
+            dst += 8;
+            i += 16;
+            continue;
+        }
+        int asciiPrefix = std::countr_zero((u32)nonAscii);
+#else
+        uint8x16_t chunk = vld1q_u8((const u8*)(src + i));
+        if (vmaxvq_u8(chunk) < 0x80) {
+            vst1q_u16((u16*)dst, vmovl_u8(vget_low_u8(chunk)));
+            vst1q_u16((u16*)(dst + 8), vmovl_high_u8(chunk));
+            dst += 16;
+            i += 16;
+            continue;
+        }
+        // Eight 2-byte sequences, with the lead bytes in the lower halves of the lanes.
+        uint16x8_t lanes = vreinterpretq_u16_u8(chunk);
+        if (vminvq_u16(vceqq_u16(vandq_u16(lanes, vdupq_n_u16(0xC0E0)), vdupq_n_u16(0x80C0))) == 0xFFFF) {
+            uint16x8_t lead = vandq_u16(lanes, vdupq_n_u16(0x1F));
+            uint16x8_t continuation = vandq_u16(vshrq_n_u16(lanes, 8), vdupq_n_u16(0x3F));
+            vst1q_u16((u16*)dst, vorrq_u16(vshlq_n_u16(lead, 6), continuation));
+            dst += 8;
+            i += 16;
+            continue;
+        }
+        int asciiPrefix = Simd::lowestLane(Simd::toMask(vcgeq_u8(chunk, vdupq_n_u8(0x80))));
+#endif
+        // Mixed lengths, the ASCII bytes up to the first sequence and that sequence are decoded on their own.
+        for (int end = i + asciiPrefix; i < end; i++) {
+            *dst++ = (char16)src[i];
+        }
+        int codepoint = measureCodepoint(src[i]);
+        *dst++ = utf8ToWChar(src + i, codepoint);
+        i += codepoint;
+    }
+#endif
+    while (i < length) {
+        int codepoint = measureCodepoint(src[i]);
+        *dst++ = utf8ToWChar(src + i, codepoint);
+        i += codepoint;
+    }
+    return (int)(dst - utf16.data());
 }
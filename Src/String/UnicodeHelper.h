@@ -10,6 +10,13 @@ namespace Unicode {
     char16 utf8ToWChar(const char* cbuffer);
     char16 utf8ToWChar(const char* cbuffer, int codepointLen);
     byte wCharToUtf8(char16 chr, char* result);
+
+    /// Counts the codepoints in the first byteLength bytes of buf by counting all bytes that are not continuation bytes.
+    /// Equal to stepping through buf via #measureCodepoint for well-formed UTF-8.
+    int countCodepoints(const char* buf, int byteLength);
+    /// Checks whether the first byteLength bytes of buf are well-formed UTF-8 (RFC 3629), counting the codepoints on the way.
+    /// @returns Whether buf is valid, count is only meaningful if it is.
+    bool validateAndCount(const char* buf, int byteLength, int& count);
 }
 
 }
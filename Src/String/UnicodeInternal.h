@@ -1,15 +1,16 @@
 #ifndef PGE_UNICODEINTERNAL_H_INCLUDED
 #define PGE_UNICODEINTERNAL_H_INCLUDED
 
-#include <PGE/String/String.h>
+#include <PGE/String/StringBuilder.h>
 #include <PGE/Types/CircularArray.h>
 
 namespace PGE {
 
 namespace Unicode {
 	void fold(CircularArray<char16>& queue, char16 ch);
-	void up(String& str, char16 ch);
-	void down(String& str, char16 ch);
+	void fold(StringBuilder& str, char16 ch);
+	void up(StringBuilder& str, char16 ch);
+	void down(StringBuilder& str, char16 ch);
 }
 
 }
@@ -10,14 +10,22 @@ StructuredData::ElemLayout::LocationAndSize::LocationAndSize(int loc, int sz) {
     location = loc; size = sz;
 }
 
-const StructuredData::ElemLayout::LocationAndSize& StructuredData::ElemLayout::getLocationAndSize(const String& name) const {
-    return getLocationAndSize(String::Key(name));
+const StructuredData::ElemLayout::Entries::Entry& StructuredData::ElemLayout::getEntry(const String& name) const {
+    auto iter = entries.find(name);
+    PGE_ASSERT(iter != entries.end(), "No entry named \"" + name + "\"");
+    return *iter;
 }
 
-const StructuredData::ElemLayout::LocationAndSize& StructuredData::ElemLayout::getLocationAndSize(const String::Key& key) const {
+const StructuredData::ElemLayout::Entries::Entry& StructuredData::ElemLayout::getEntry(const InternedString& name) const {
+    auto iter = entries.find(name);
+    PGE_ASSERT(iter != entries.end(), "No entry named \"" + name.str() + "\"");
+    return *iter;
+}
+
+const StructuredData::ElemLayout::Entries::Entry& StructuredData::ElemLayout::getEntry(const String::Key& key) const {
     auto iter = entries.find(key);
     PGE_ASSERT(iter != entries.end(), "No entry with key \"" + String::hexFromInt(key.hash) + "\"");
-    return iter->second;
+    return *iter;
 }
 
 int StructuredData::ElemLayout::getElementSize() const {
@@ -58,18 +66,17 @@ const StructuredData::ElemLayout& StructuredData::getLayout() const {
     return layout;
 }
 
-int StructuredData::getDataIndex(int elemIndex, const String::Key& entry, int expectedSize) const {
+int StructuredData::getDataIndex(int elemIndex, const ElemLayout::Entries::Entry& entry, int expectedSize) const {
     PGE_ASSERT(elemIndex >= 0, "Requested a negative element index (" + String::from(elemIndex) + ")");
 
     int elemOffset = elemIndex * layout.getElementSize();
     PGE_ASSERT(elemOffset <= (size - layout.getElementSize()),
-        "Requested an element index greater than the number of elements ("
-        + String::from(elemOffset) + " > " + String::from((int)(size - layout.getElementSize())) + ")");
+        String::concat("Requested an element index greater than the number of elements (",
+            String::from(elemOffset), " > ", String::from((int)(size - layout.getElementSize())), ")"));
 
-    const ElemLayout::LocationAndSize& locAndSize = layout.getLocationAndSize(entry);
+    const ElemLayout::LocationAndSize& locAndSize = entry.second;
     PGE_ASSERT(locAndSize.size == expectedSize,
-        "Entry \"" + String::hexFromInt(entry.hash) + "\" size mismatch (expected " + String::from(locAndSize.size)
-        + ", got " + String::from(expectedSize) + ")");
+        String::concat("Entry \"", entry.first.str(), "\" size mismatch (expected ", String::from(locAndSize.size), ", got ", String::from(expectedSize), ")"));
 
     return elemOffset + locAndSize.location;
 }
@@ -0,0 +1,30 @@
+#ifndef PULSE_BENCHMARK_H_INCLUDED
+#define PULSE_BENCHMARK_H_INCLUDED
+
+#include "Util.h"
+
+#include <chrono>
+
+#include <PGE/Types/Types.h>
+
+// Benchmarks are skipped unless run with --no-skip.
+#define BENCHMARK_SUITE(name) TEST_SUITE(name * doctest::skip())
+
+inline volatile PGE::u64 benchmarkSink;
+
+// Calls func(i) for i in [0, iterations) and prints the average time per call.
+// func returns a checksum of its work, so it can't be optimized away.
+template <typename F>
+double benchmark(const char* name, int iterations, F func) {
+	PGE::u64 checksum = func(0);
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; i++) {
+		checksum += (PGE::u64)func(i);
+	}
+	double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+	benchmarkSink = benchmarkSink + checksum;
+	pgeCout << name << ": " << ns << " ns" << std::endl;
+	return ns;
+}
+
+#endif // PULSE_BENCHMARK_H_INCLUDED
@@ -0,0 +1,84 @@
+#include "Benchmark.h"
+
+#include <deque>
+#include <vector>
+
+#include <PGE/Types/CircularArray.h>
+
+using namespace PGE;
+
+BENCHMARK_SUITE("Circular array benchmarks") {
+
+TEST_CASE("Event queue") {
+	// A queue that stays short, with events coming in and getting handled one by one.
+	CircularArray<u64> events;
+	std::deque<u64> dequeEvents;
+	for (int i : Range(48)) {
+		events.pushBack(i);
+		dequeEvents.push_back(i);
+	}
+	benchmark("CircularArray push and pop", 100'000'000, [&](int i) {
+		events.pushBack(i);
+		u64 ret = events.front();
+		events.popFront();
+		return ret;
+	});
+	benchmark("std::deque push and pop", 100'000'000, [&](int i) {
+		dequeEvents.push_back(i);
+		u64 ret = dequeEvents.front();
+		dequeEvents.pop_front();
+		return ret;
+	});
+	benchmark("CircularArray indexing", 100'000'000, [&](int i) { return events[i % 48]; });
+	benchmark("std::deque indexing", 100'000'000, [&](int i) { return dequeEvents[i % 48]; });
+}
+
+TEST_CASE("Sample queue") {
+	// Audio arrives and gets consumed in blocks of differing sizes.
+	std::vector<float> block(1024);
+	for (int i : Range(1024)) {
+		block[i] = (float)i;
+	}
+	CircularArray<float> samples;
+	std::deque<float> dequeSamples;
+	benchmark("CircularArray pushBack(span) and popFront(n)", 1'000'000, [&](int i) {
+		samples.pushBack(std::span(block).first(512 + i % 512));
+		float ret = samples.front();
+		samples.popFront(std::min(samples.size(), (size_t)768));
+		return (u64)ret;
+	});
+	benchmark("CircularArray per sample", 1'000'000, [&](int i) {
+		for (float f : std::span(block).first(512 + i % 512)) {
+			samples.pushBack(f);
+		}
+		float ret = samples.front();
+		for (size_t j = std::min(samples.size(), (size_t)768); j > 0; j--) {
+			samples.popFront();
+		}
+		return (u64)ret;
+	});
+	benchmark("std::deque insert and erase", 1'000'000, [&](int i) {
+		dequeSamples.insert(dequeSamples.end(), block.begin(), block.begin() + 512 + i % 512);
+		float ret = dequeSamples.front();
+		dequeSamples.erase(dequeSamples.begin(), dequeSamples.begin() + std::min(dequeSamples.size(), (size_t)768));
+		return (u64)ret;
+	});
+	benchmark("Summing CircularArray via asSpans", 1'000'000, [&](int) {
+		float sum = 0.0f;
+		for (std::span<const float> span : samples.asSpans()) {
+			for (float f : span) {
+				sum += f;
+			}
+		}
+		return (u64)sum;
+	});
+	benchmark("Summing std::deque", 1'000'000, [&](int) {
+		float sum = 0.0f;
+		for (float f : dequeSamples) {
+			sum += f;
+		}
+		return (u64)sum;
+	});
+}
+
+}
@@ -287,6 +287,80 @@ TEST_CASE("Iterator random access") {
     }
 }
 
+TEST_CASE("Spans") {
+    CircularArray<int> ints;
+    CHECK(ints.asSpans()[0].empty());
+    CHECK(ints.asSpans()[1].empty());
+
+    ints = { 0, 1, 2, 3 };
+    CHECK(ints.asSpans()[0].size() == 4);
+    CHECK(ints.asSpans()[1].empty());
+
+    // Wraps around the end of the buffer.
+    ints.popFront();
+    ints.popFront();
+    ints.pushBack(4);
+    ints.pushBack(5);
+    const CircularArray<int>& constInts = ints;
+    std::array<std::span<const int>, 2> spans = constInts.asSpans();
+    CHECK(spans[0].size() == 2);
+    CHECK(spans[1].size() == 2);
+    for (int i = 2; std::span<const int> span : spans) {
+        for (int e : span) {
+            CHECK(e == i++);
+        }
+    }
+}
+
+TEST_CASE("Bulk push and pop") {
+    std::vector<int> source(100);
+    for (int i : Range(100)) {
+        source[i] = i;
+    }
+    CircularArray<int> ints;
+    ints.pushBack(std::span(source).first(3));
+    ints.popFront(2);
+    // Every chunk ends up split differently across the end of the buffer.
+    int expected = 2;
+    for (int i : Range(1, 10)) {
+        ints.pushBack(std::span(source).subspan(3 + (i - 1) * i / 2, i));
+        CHECK(ints.back() == 2 + i * (i + 1) / 2);
+        ints.popFront(i);
+        expected += i;
+        CHECK(ints.front() == expected);
+        CHECK(ints.size() == 1);
+    }
+    ints.popFront(1);
+    CHECK(ints.empty());
+    CHECK_THROWS_AS(ints.popFront(1), Exception);
+
+    CircularArray<std::string> strings{ "a", "b" };
+    std::vector<std::string> moreStrings{ "c", "d", "e" };
+    strings.popFront(1);
+    strings.pushBack(moreStrings);
+    CHECK((strings == std::vector<std::string>{ "b", "c", "d", "e" }));
+}
+
+TEST_CASE("Bulk push of its own elements") {
+    // Both have to grow, which frees the elements being pushed.
+    CircularArray<int> ints{ 1, 2, 3, 4 };
+    ints.pushBack(ints.asSpans()[0]);
+    CHECK((ints == std::vector<int>{ 1, 2, 3, 4, 1, 2, 3, 4 }));
+
+    CircularArray<std::string> strings{ "a long enough string to not be stored inline", "b", "c", "d" };
+    strings.pushBack(strings.asSpans()[0].first(2));
+    CHECK((strings == std::vector<std::string>{ "a long enough string to not be stored inline", "b", "c", "d",
+        "a long enough string to not be stored inline", "b" }));
+
+    // Copying leaves the source alone.
+    CircularArray<std::string> copy;
+    copy = strings;
+    for (size_t i : Range(strings.size())) {
+        CHECK(copy[i] == strings[i]);
+    }
+    CHECK(strings.front() == "a long enough string to not be stored inline");
+}
+
 struct MemLeakTester {
     static int counter;
     MemLeakTester() { counter++; }
@@ -332,6 +406,20 @@ TEST_CASE("MemLeakTester clear") {
     CHECK(MemLeakTester::counter == 0);
 }
 
+TEST_CASE("MemLeakTester bulk") {
+    CHECK(MemLeakTester::counter == 0);
+    {
+        std::vector<MemLeakTester> source(10);
+        CircularArray<MemLeakTester> test;
+        for (int i : Range(10)) {
+            test.pushBack(source);
+            test.popFront(7);
+        }
+        CHECK(test.size() == 30);
+    }
+    CHECK(MemLeakTester::counter == 0);
+}
+
 TEST_CASE("MemLeakTester fill") {
     CHECK(MemLeakTester::counter == 0);
     {
@@ -0,0 +1,231 @@
+#include "Util.h"
+
+#include <thread>
+#include <string>
+
+#include <PGE/Types/SpscRing.h>
+#include <PGE/Types/MpmcQueue.h>
+#include <PGE/Types/Range.h>
+
+using namespace PGE;
+
+// The stress tests are meant to also be run under ThreadSanitizer, which reports races that don't fail any check.
+TEST_SUITE("Concurrent queues") {
+
+TEST_CASE("SpscRing basics") {
+    SpscRing<int> ring(5);
+    CHECK(ring.getCapacity() == 8);
+    CHECK(ring.empty());
+    CHECK(!ring.tryPopFront().has_value());
+
+    for (int i : Range(8)) {
+        CHECK(ring.tryPushBack(i));
+    }
+    CHECK(!ring.tryPushBack(8));
+    CHECK(ring.size() == 8);
+    for (int i : Range(8)) {
+        CHECK(ring.tryPopFront() == i);
+    }
+    CHECK(ring.empty());
+}
+
+TEST_CASE("SpscRing batches") {
+    SpscRing<int> ring(8);
+    std::vector<int> source{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    std::vector<int> dest(10);
+    // Every batch ends up split differently across the end of the buffer.
+    for (int offset : Range(8)) {
+        CHECK(ring.tryPushBack(std::span(source).first(offset)) == offset);
+        CHECK(ring.tryPopFront(std::span(dest).first(offset)) == offset);
+        CHECK(ring.tryPushBack(source) == 8);
+        CHECK(ring.tryPopFront(dest) == 8);
+        for (int i : Range(8)) {
+            CHECK(dest[i] == i);
+        }
+    }
+    CHECK(ring.tryPopFront(dest) == 0);
+}
+
+TEST_CASE("SpscRing destroys what is left") {
+    std::shared_ptr<int> shared = std::make_shared<int>(42);
+    {
+        SpscRing<std::shared_ptr<int>> ring(4);
+        ring.tryPushBack(shared);
+        ring.tryPushBack(shared);
+        ring.tryPopFront();
+        ring.tryPushBack(shared);
+        CHECK(shared.use_count() == 3);
+    }
+    CHECK(shared.use_count() == 1);
+}
+
+TEST_CASE("SpscRing batches with throwing copies") {
+    struct ThrowingCopy {
+        std::shared_ptr<int> shared;
+        bool throws;
+        ThrowingCopy(const std::shared_ptr<int>& s, bool t) : shared(s), throws(t) { }
+        ThrowingCopy(const ThrowingCopy& other) : shared(other.shared), throws(other.throws) { if (throws) { throw 0; } }
+    };
+
+    std::shared_ptr<int> shared = std::make_shared<int>(42);
+    ThrowingCopy source[] = { { shared, false }, { shared, false }, { shared, true } };
+    SpscRing<ThrowingCopy> ring(4);
+    // Once within the buffer and once split across its end.
+    for (int offset : { 0, 3 }) {
+        for (PGE_IT : Range(offset)) {
+            ring.tryPushBack(source[0]);
+            ring.tryPopFront();
+        }
+        CHECK_THROWS(ring.tryPushBack(std::span<const ThrowingCopy>(source)));
+        CHECK(ring.empty());
+        CHECK(shared.use_count() == 4);
+    }
+    CHECK(ring.tryPushBack(std::span<const ThrowingCopy>(source).first(2)) == 2);
+    CHECK(ring.size() == 2);
+}
+
+TEST_CASE("SpscRing stress") {
+    static constexpr int COUNT = 200'000;
+    SpscRing<std::string> ring(64);
+    std::thread producer([&ring]() {
+        std::vector<std::string> batch;
+        for (int i = 0; i < COUNT;) {
+            // Alternating between single elements and batches.
+            if (i % 3 == 0) {
+                while (!ring.tryPushBack(std::to_string(i))) { std::this_thread::yield(); }
+                i++;
+            } else {
+                batch.clear();
+                for (int j = i; j < std::min(i + 10, COUNT); j++) {
+                    batch.emplace_back(std::to_string(j));
+                }
+                size_t pushed = ring.tryPushBack(batch);
+                if (pushed == 0) { std::this_thread::yield(); }
+                i += (int)pushed;
+            }
+        }
+    });
+    int expected = 0;
+    bool inOrder = true;
+    std::vector<std::string> batch(7);
+    while (expected < COUNT) {
+        if (expected % 2 == 0) {
+            std::optional<std::string> str = ring.tryPopFront();
+            if (str.has_value()) {
+                inOrder &= *str == std::to_string(expected++);
+            } else {
+                std::this_thread::yield();
+            }
+        } else {
+            size_t popped = ring.tryPopFront(batch);
+            if (popped == 0) { std::this_thread::yield(); }
+            for (size_t i : Range(popped)) {
+                inOrder &= batch[i] == std::to_string(expected++);
+            }
+        }
+    }
+    producer.join();
+    CHECK(inOrder);
+    CHECK(ring.empty());
+}
+
+TEST_CASE("MpmcQueue basics") {
+    MpmcQueue<int> queue(1);
+    CHECK(queue.getCapacity() == 2);
+    CHECK(queue.tryPushBack(1));
+    CHECK(queue.tryPushBack(2));
+    CHECK(!queue.tryPushBack(3));
+    CHECK(queue.tryPopFront() == 1);
+    CHECK(queue.tryPushBack(3));
+    CHECK(queue.size() == 2);
+    CHECK(queue.tryPopFront() == 2);
+    CHECK(queue.tryPopFront() == 3);
+    CHECK(!queue.tryPopFront().has_value());
+    CHECK(queue.empty());
+}
+
+TEST_CASE("MpmcQueue destroys what is left") {
+    std::shared_ptr<int> shared = std::make_shared<int>(42);
+    {
+        MpmcQueue<std::shared_ptr<int>> queue(4);
+        for (PGE_IT : Range(6)) {
+            queue.tryPushBack(shared);
+            queue.tryPushBack(shared);
+            queue.tryPopFront();
+        }
+        CHECK(shared.use_count() == 4);
+    }
+    CHECK(shared.use_count() == 1);
+}
+
+TEST_CASE("MpmcQueue with throwing constructors") {
+    struct Throwing {
+        int value;
+        Throwing(int v) : value(v) { if (v < 0) { throw v; } }
+        Throwing(Throwing&&) noexcept = default;
+    };
+
+    MpmcQueue<Throwing> queue(2);
+    CHECK_THROWS(queue.tryEmplaceBack(-1));
+    CHECK(queue.empty());
+    CHECK(queue.tryEmplaceBack(1));
+    CHECK(queue.tryEmplaceBack(2));
+    CHECK(!queue.tryEmplaceBack(3));
+    CHECK(queue.tryPopFront()->value == 1);
+    CHECK(queue.tryPopFront()->value == 2);
+}
+
+TEST_CASE("MpmcQueue stress") {
+    constexpr int THREAD_COUNT = 4;
+    constexpr int COUNT = 50'000;
+    MpmcQueue<u64> queue(64);
+
+    std::vector<std::thread> threads;
+    for (int t : Range(THREAD_COUNT)) {
+        threads.emplace_back([&queue, t]() {
+            for (int i : Range(COUNT)) {
+                while (!queue.tryPushBack((u64)t << 32 | (u64)i)) { std::this_thread::yield(); }
+            }
+        });
+    }
+
+    std::vector<std::vector<u64>> popped(THREAD_COUNT);
+    std::atomic<int> remaining = THREAD_COUNT * COUNT;
+    for (int t : Range(THREAD_COUNT)) {
+        threads.emplace_back([&queue, &popped, &remaining, t]() {
+            while (remaining.load(std::memory_order_relaxed) > 0) {
+                std::optional<u64> value = queue.tryPopFront();
+                if (value.has_value()) {
+                    popped[t].push_back(*value);
+                    remaining.fetch_sub(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Every consumer sees each producer's elements in order, and every element is popped exactly once.
+    std::vector<int> seen(THREAD_COUNT);
+    bool inOrder = true;
+    for (const std::vector<u64>& values : popped) {
+        std::vector<int> last(THREAD_COUNT, -1);
+        for (u64 value : values) {
+            int producer = (int)(value >> 32);
+            int index = (int)(value & 0xFFFFFFFF);
+            inOrder &= index > last[producer];
+            last[producer] = index;
+            seen[producer]++;
+        }
+    }
+    CHECK(inOrder);
+    for (int t : Range(THREAD_COUNT)) {
+        CHECK(seen[t] == COUNT);
+    }
+    CHECK(queue.empty());
+}
+
+}
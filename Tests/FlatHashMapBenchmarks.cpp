@@ -0,0 +1,75 @@
+#include "Benchmark.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include <PGE/Types/FlatHashMap.h>
+#include <PGE/String/InternedString.h>
+
+using namespace PGE;
+
+// Shaped like a shader's constants, looked up by name every frame.
+static std::vector<String> uniformNames(int count) {
+	std::vector<String> ret;
+	for (int i : Range(count)) {
+		ret.emplace_back("uniform_" + String::from(i));
+	}
+	return ret;
+}
+
+BENCHMARK_SUITE("Flat hash map benchmarks") {
+
+TEST_CASE("Lookups") {
+	for (int count : { 8, 32, 1024 }) {
+		std::vector<String> names = uniformNames(count);
+		std::vector<String::Key> keys;
+		std::vector<InternedString> interned;
+		FlatHashMap<InternedString, int> flat;
+		std::unordered_map<InternedString, int> unordered;
+		for (int i : Range(count)) {
+			keys.emplace_back(names[i]);
+			interned.emplace_back(names[i].intern());
+			flat.emplace(interned[i], i);
+			unordered.emplace(interned[i], i);
+		}
+		pgeCout << count << " entries" << std::endl;
+		benchmark("  FlatHashMap by InternedString", 10'000'000, [&](int i) { return flat.find(interned[i % count])->second; });
+		benchmark("  std::unordered_map by InternedString", 10'000'000, [&](int i) { return unordered.find(interned[i % count])->second; });
+		benchmark("  FlatHashMap by String::Key", 10'000'000, [&](int i) { return flat.find(keys[i % count])->second; });
+		benchmark("  std::unordered_map by String::Key", 10'000'000, [&](int i) { return unordered.find(keys[i % count])->second; });
+		benchmark("  FlatHashMap by String", 10'000'000, [&](int i) { return flat.find(names[i % count])->second; });
+		benchmark("  std::unordered_map by String", 10'000'000, [&](int i) { return unordered.find(names[i % count])->second; });
+		benchmark("  FlatHashMap missing", 10'000'000, [&](int i) { return flat.contains(String::Key((u64)i)); });
+		benchmark("  std::unordered_map missing", 10'000'000, [&](int i) { return unordered.contains(String::Key((u64)i)); });
+	}
+}
+
+TEST_CASE("Iteration") {
+	for (int count : { 8, 32, 1024 }) {
+		std::vector<String> names = uniformNames(count);
+		FlatHashMap<InternedString, int> flat;
+		std::unordered_map<InternedString, int> unordered;
+		for (int i : Range(count)) {
+			flat.emplace(names[i].intern(), i);
+			unordered.emplace(names[i].intern(), i);
+		}
+		int iterations = 100'000'000 / count;
+		pgeCout << count << " entries" << std::endl;
+		benchmark("  FlatHashMap", iterations, [&](int) {
+			u64 sum = 0;
+			for (const auto& [_, value] : flat) {
+				sum += value;
+			}
+			return sum;
+		});
+		benchmark("  std::unordered_map", iterations, [&](int) {
+			u64 sum = 0;
+			for (const auto& [_, value] : unordered) {
+				sum += value;
+			}
+			return sum;
+		});
+	}
+}
+
+}
@@ -0,0 +1,150 @@
+#include "Util.h"
+
+#include <unordered_map>
+#include <random>
+
+#include <PGE/Types/FlatHashMap.h>
+#include <PGE/Types/Range.h>
+#include <PGE/String/InternedString.h>
+
+using namespace PGE;
+
+// Only four distinct hashes, so all keys share four control bytes and start probing in the same group, which takes the slow paths.
+struct CollidingHash {
+    size_t operator()(int i) const {
+        return (size_t)(i % 4);
+    }
+};
+
+TEST_SUITE("Flat hash map") {
+
+TEST_CASE("Emplace and find") {
+    FlatHashMap<int, int> map;
+    CHECK(map.empty());
+    CHECK(map.find(1) == map.end());
+    for (int i : Range(1000)) {
+        CHECK(map.emplace(i, i * 2).second);
+    }
+    CHECK(map.size() == 1000);
+    CHECK(!map.emplace(5, 0).second);
+    CHECK(map.emplace(5, 0).first->second == 10);
+    for (int i : Range(1000)) {
+        CHECK(map.find(i)->second == i * 2);
+    }
+    CHECK(!map.contains(1000));
+    CHECK(!map.contains(-1));
+
+    map[5] = 3;
+    CHECK(map.find(5)->second == 3);
+    CHECK(map[2000] == 0);
+    CHECK(map.size() == 1001);
+}
+
+TEST_CASE("Iteration order") {
+    FlatHashMap<int, int> map;
+    for (int i : Range(100)) {
+        map.emplace(i * 7919, i);
+    }
+    int expected = 0;
+    for (const auto& [key, value] : map) {
+        CHECK(key == expected * 7919);
+        CHECK(value == expected);
+        expected++;
+    }
+    CHECK(expected == 100);
+}
+
+TEST_CASE("Erase") {
+    FlatHashMap<int, std::string> map;
+    for (int i : Range(200)) {
+        map.emplace(i, std::to_string(i));
+    }
+    for (int i = 0; i < 200; i += 3) {
+        CHECK(map.erase(i) == 1);
+    }
+    CHECK(map.erase(0) == 0);
+    for (int i : Range(200)) {
+        auto it = map.find(i);
+        if (i % 3 == 0) {
+            CHECK(it == map.end());
+        } else {
+            CHECK(it->second == std::to_string(i));
+        }
+    }
+    for (int i = 0; i < 200; i += 3) {
+        map.emplace(i, std::to_string(i));
+    }
+    CHECK(map.size() == 200);
+    for (const auto& [key, value] : map) {
+        CHECK(value == std::to_string(key));
+    }
+}
+
+TEST_CASE("Collisions") {
+    FlatHashMap<int, int, CollidingHash> map;
+    // Deleted slots pile up, and have to be cleaned up for the map not to fill up.
+    for (int round : Range(50)) {
+        for (int i : Range(40)) {
+            map.emplace(round * 40 + i, i);
+        }
+        for (int i : Range(40)) {
+            CHECK(map.find(round * 40 + i)->second == i);
+        }
+        for (int i : Range(40)) {
+            map.erase(round * 40 + i);
+        }
+        CHECK(map.empty());
+    }
+}
+
+TEST_CASE("Random operations") {
+    std::mt19937 rng(42);
+    FlatHashMap<u32, u32> map;
+    std::unordered_map<u32, u32> reference;
+    for (int i : Range(100'000)) {
+        u32 key = rng() % 2000;
+        if (rng() % 3 == 0) {
+            CHECK(map.erase(key) == reference.erase(key));
+        } else {
+            CHECK(map.emplace(key, (u32)i).second == reference.emplace(key, (u32)i).second);
+        }
+    }
+    CHECK(map.size() == reference.size());
+    for (const auto& [key, value] : reference) {
+        CHECK(map.find(key)->second == value);
+    }
+}
+
+TEST_CASE("Copy and compare") {
+    FlatHashMap<int, int> a;
+    FlatHashMap<int, int> b;
+    for (int i : Range(50)) {
+        a.emplace(i, i);
+        b.emplace(49 - i, 49 - i);
+    }
+    CHECK(a == b);
+    b[3] = 4;
+    CHECK(!(a == b));
+
+    b = a;
+    CHECK(a == b);
+    FlatHashMap<int, int> c = std::move(b);
+    CHECK(a == c);
+    c.clear();
+    CHECK(c.empty());
+    CHECK(c.find(1) == c.end());
+    c.emplace(1, 1);
+    CHECK(c.find(1)->second == 1);
+}
+
+TEST_CASE("Interned keys") {
+    FlatHashMap<InternedString, int> map;
+    map.emplace(String("position").intern(), 0);
+    map.emplace(String("normal").intern(), 1);
+    CHECK(map.find(String("position").intern())->second == 0);
+    CHECK(map.find(String("normal"))->second == 1);
+    CHECK(map.find("position"_key)->second == 0);
+    CHECK(map.find(String("uv")) == map.end());
+}
+
+}
@@ -0,0 +1,67 @@
+#include "Benchmark.h"
+
+#include <random>
+
+#include <PGE/Math/Hasher.h>
+#include <PGE/String/String.h>
+
+using namespace PGE;
+
+// The byte-at-a-time FNV-1a Hasher used to be.
+static u64 fnv1a(std::span<const byte> data) {
+	u64 hash = 0xcbf29ce484222325;
+	for (byte b : data) {
+		hash ^= b;
+		hash *= 0x00000100000001b3u;
+	}
+	return hash;
+}
+
+static std::vector<byte> randomBytes(int count) {
+	std::mt19937 rng(1234);
+	std::vector<byte> ret(count);
+	for (byte& b : ret) {
+		b = (byte)rng();
+	}
+	return ret;
+}
+
+BENCHMARK_SUITE("Hasher benchmarks") {
+
+TEST_CASE("Short keys") {
+	std::vector<byte> data = randomBytes(64);
+	for (int size : { 4, 8, 12, 16, 24, 32 }) {
+		pgeCout << size << " bytes" << std::endl;
+		// Vary the offset, so the keys are not all the same.
+		benchmark("  FNV-1a", 10'000'000, [&](int i) { return fnv1a(std::span(data.data() + (i & 31), size)); });
+		benchmark("  Hasher", 10'000'000, [&](int i) { return Hasher::getHash(std::span(data.data() + (i & 31), size)); });
+	}
+}
+
+TEST_CASE("Long buffers") {
+	for (int size : { 1024, 64 * 1024, 16 * 1024 * 1024 }) {
+		std::vector<byte> data = randomBytes(size);
+		int iterations = 256 * 1024 * 1024 / size;
+		pgeCout << size << " bytes" << std::endl;
+		benchmark("  FNV-1a", iterations, [&](int) { return fnv1a(data); });
+		benchmark("  Hasher", iterations, [&](int) { return Hasher::getHash(std::span(data)); });
+	}
+}
+
+TEST_CASE("Streaming") {
+	std::vector<byte> data = randomBytes(4096);
+	benchmark("Hasher feeding 16 byte chunks", 100'000, [&](int) {
+		Hasher hasher;
+		for (int i = 0; i < 4096; i += 16) {
+			hasher.feed(std::span(data.data() + i, 16));
+		}
+		return hasher.getHash();
+	});
+}
+
+TEST_CASE("String keys") {
+	String str = "some_uniform_name";
+	benchmark("String::getHashCode on fresh copies", 10'000'000, [&](int) { return String(str.cstr()).getHashCode(); });
+}
+
+}
@@ -1,6 +1,7 @@
 #include "Util.h"
 
 #include <PGE/Math/Math.h>
+#include <PGE/Math/Hasher.h>
 
 using namespace PGE;
 
@@ -28,3 +29,27 @@ TEST_CASE_TEMPLATE("Math", F, float, double, long double) {
 	testAllFuncs<F, 1.L>();
 	testAllFuncs<F, 2.L>();
 }
+
+TEST_CASE("Hasher") {
+	static constexpr char TEXT[] = "The quick brown fox jumps over the lazy dog, twice as quick as the lazy fox.";
+	constexpr std::span<const char> text(TEXT, sizeof(TEXT) - 1);
+	constexpr u64 COMPILE_TIME = Hasher::getHash(text);
+	CHECK(COMPILE_TIME == Hasher::getHash(text));
+
+	// Only the byte sequence matters, not how it's fed.
+	for (size_t i = 0; i <= text.size(); i++) {
+		Hasher hasher;
+		hasher.feed(text.subspan(0, i));
+		hasher.feed(text.subspan(i));
+		CHECK(hasher.getHash() == COMPILE_TIME);
+	}
+
+	Hasher integers;
+	integers.feed((u32)0x03020100);
+	integers.feed((u16)0x0504);
+	const byte BYTES[] = { 0, 1, 2, 3, 4, 5 };
+	CHECK(integers.getHash() == Hasher::getHash(std::span(BYTES)));
+
+	CHECK(Hasher::getHash(text.subspan(0, 10)) != Hasher::getHash(text.subspan(0, 11)));
+	CHECK(Hasher().getHash() != Hasher::getHash(std::span(BYTES, 1)));
+}
@@ -0,0 +1,116 @@
+#include "Util.h"
+
+#include <PGE/ResourceManagement/ResourceManager.h>
+#include <PGE/Types/Range.h>
+
+using namespace PGE;
+
+// Logs its value when destroyed.
+class LoggingResource : public Resource<int> {
+    public:
+        LoggingResource(int value, std::vector<int>& log) : log(log) {
+            resource = value;
+        }
+
+        ~LoggingResource() {
+            log.push_back(resource);
+        }
+
+    private:
+        std::vector<int>& log;
+};
+
+// Too big to fit into a slot.
+class BigResource : public Resource<int> {
+    public:
+        BigResource(int value, std::vector<int>& log) : log(log) {
+            resource = value;
+        }
+
+        ~BigResource() {
+            log.push_back(resource);
+        }
+
+    private:
+        std::vector<int>& log;
+        byte padding[256];
+};
+
+class ThrowingResource : public Resource<int> {
+    public:
+        ThrowingResource() {
+            throw Exception("Failed to create resource");
+        }
+};
+
+TEST_SUITE("Resource manager") {
+
+TEST_CASE("Destruction order") {
+    std::vector<int> log;
+    {
+        ResourceManager manager;
+        for (int i : Range(20)) {
+            if (i % 3 == 0) {
+                manager.addNewResource<BigResource>(i, log);
+            } else {
+                manager.addNewResource<LoggingResource>(i, log);
+            }
+        }
+    }
+    CHECK(log.size() == 20);
+    for (int i : Range(20)) {
+        CHECK(log[i] == 19 - i);
+    }
+}
+
+TEST_CASE("Deleting") {
+    std::vector<int> log;
+    {
+        ResourceManager manager;
+        std::vector<LoggingResource::View> views;
+        for (int i : Range(10)) {
+            views.push_back(manager.addNewResource<LoggingResource>(i, log));
+        }
+        for (int i : { 9, 0, 4, 5 }) {
+            CHECK(manager.isAlive(views[i]));
+            manager.deleteResource(views[i]);
+            CHECK(!manager.isAlive(views[i]));
+        }
+        CHECK(log == std::vector<int>{ 9, 0, 4, 5 });
+        CHECK_THROWS(manager.deleteResource(views[4]));
+        manager.deleteResource(LoggingResource::View());
+
+        // Reuses the freed slots, without reviving the old views.
+        for (int i : Range(10, 14)) {
+            views.push_back(manager.addNewResource<LoggingResource>(i, log));
+        }
+        for (int i : { 9, 0, 4, 5 }) {
+            CHECK(!manager.isAlive(views[i]));
+        }
+        CHECK(views[12].get() == 12);
+        log.clear();
+    }
+    CHECK(log == std::vector<int>{ 13, 12, 11, 10, 8, 7, 6, 3, 2, 1 });
+}
+
+TEST_CASE("Failed construction") {
+    std::vector<int> log;
+    {
+        ResourceManager manager;
+        manager.addNewResource<LoggingResource>(0, log);
+        CHECK_THROWS(manager.addNewResource<ThrowingResource>());
+        auto view = manager.addNewResource<LoggingResource>(1, log);
+        CHECK(manager.isAlive(view));
+    }
+    CHECK(log == std::vector<int>{ 1, 0 });
+}
+
+TEST_CASE("Raw wrappers") {
+    ResourceManager manager;
+    auto view = manager.addNew<std::vector<int>>(3, 7);
+    CHECK(view->size() == 3);
+    CHECK((*view.get())[2] == 7);
+    manager.deleteResource(view);
+}
+
+}
@@ -0,0 +1,109 @@
+#include "Util.h"
+
+#include <string>
+
+#include <PGE/Types/SmallVector.h>
+#include <PGE/Types/Range.h>
+
+using namespace PGE;
+
+TEST_SUITE("Small vector") {
+
+TEST_CASE("Static asserts") {
+    static_assert(std::ranges::contiguous_range<SmallVector<int, 4>>);
+    static_assert(std::ranges::sized_range<SmallVector<int, 4>>);
+}
+
+TEST_CASE("Inline until full") {
+    SmallVector<int, 4> ints;
+    CHECK(ints.empty());
+    CHECK(ints.capacity() == 4);
+    for (int i : Range(4)) {
+        ints.push_back(i);
+    }
+    CHECK(!ints.isAllocated());
+    ints.push_back(4);
+    CHECK(ints.isAllocated());
+    CHECK(ints.size() == 5);
+    for (int i : Range(5)) {
+        CHECK(ints[i] == i);
+    }
+    CHECK(ints.front() == 0);
+    CHECK(ints.back() == 4);
+    ints.pop_back();
+    CHECK(ints == std::vector<int>{ 0, 1, 2, 3 });
+    CHECK_THROWS(ints[4]);
+    CHECK_THROWS(ints.at(4));
+    CHECK(ints.at(3) == 3);
+}
+
+TEST_CASE("Insert, erase and resize") {
+    SmallVector<std::string, 4> strs{ "a", "c" };
+    CHECK(*strs.insert(strs.begin() + 1, "b") == "b");
+    strs.insert(strs.end(), "d");
+    CHECK(!strs.isAllocated());
+    strs.emplace(strs.begin(), 2, 'z');
+    CHECK(strs.isAllocated());
+    CHECK(strs == std::vector<std::string>{ "zz", "a", "b", "c", "d" });
+    strs.insert(strs.begin(), strs[4]);
+    CHECK(strs.front() == "d");
+
+    CHECK(*strs.erase(strs.begin()) == "zz");
+    CHECK(strs.erase(strs.begin() + 1, strs.begin() + 3) == strs.begin() + 1);
+    CHECK(strs == std::vector<std::string>{ "zz", "c", "d" });
+    CHECK(strs.erase(strs.end() - 1) == strs.end());
+    CHECK_THROWS(strs.erase(strs.end()));
+
+    strs.resize(4);
+    CHECK(strs == std::vector<std::string>{ "zz", "c", "", "" });
+    strs.resize(1);
+    CHECK(strs.size() == 1);
+    strs.resize(12, strs[0]);
+    CHECK(strs.size() == 12);
+    CHECK(strs.back() == "zz");
+    CHECK(strs.capacity() >= 12);
+}
+
+TEST_CASE("Pushing an element of itself") {
+    SmallVector<std::string, 2> strs{ "a long enough string to not be stored inline", "b" };
+    strs.push_back(strs[0]);
+    CHECK(strs[2] == strs[0]);
+}
+
+TEST_CASE("Copy and move") {
+    for (int count : { 3, 10 }) {
+        SmallVector<std::string, 4> strs;
+        for (int i : Range(count)) {
+            strs.emplace_back(std::to_string(i));
+        }
+
+        SmallVector<std::string, 4> copy = strs;
+        CHECK(copy == strs);
+        SmallVector<std::string, 4> moved = std::move(copy);
+        CHECK(moved == strs);
+        CHECK(copy.empty());
+        CHECK(!copy.isAllocated());
+
+        copy = moved;
+        moved = std::move(strs);
+        CHECK(moved == copy);
+        copy.clear();
+        copy.push_back("reusable");
+        CHECK(copy.size() == 1);
+    }
+}
+
+TEST_CASE("References") {
+    int a = 1;
+    int b = 2;
+    ReferenceVector<int> refs{ a, b };
+    refs.emplace_back(a);
+    int sum = 0;
+    for (int i : refs) {
+        sum += i;
+    }
+    CHECK(sum == 4);
+    CHECK(&refs[2].get() == &a);
+}
+
+}
@@ -0,0 +1,274 @@
+#include "Benchmark.h"
+
+#include <variant>
+#include <memory>
+#include <random>
+#include <algorithm>
+#include <regex>
+
+#include <PGE/String/String.h>
+#include <PGE/String/StringBuilder.h>
+#include <PGE/String/Unicode.h>
+#include <PGE/String/Regex.h>
+
+using namespace PGE;
+
+// Replica of the layout String used to have, a variant of an inline buffer, a shared heap buffer and a literal.
+namespace Legacy {
+	struct Metadata {
+		u64 hashCode = 0;
+		int strLength = -1;
+		int strByteLength = -1;
+	};
+
+	struct StackAllocData {
+		Metadata data;
+		char cstrBuf[40];
+	};
+
+	struct HeapAllocData {
+		Metadata data;
+		int cCapacity;
+		std::unique_ptr<char[]> cstrBuf;
+	};
+
+	struct LiteralData {
+		Metadata data;
+		char* cstrBuf;
+	};
+
+	using String = std::variant<StackAllocData, std::shared_ptr<HeapAllocData>, LiteralData>;
+
+	static String make(const char* cstr) {
+		int len = (int)strlen(cstr);
+		if (len + 1 <= 40) {
+			StackAllocData stack;
+			stack.data.strByteLength = len;
+			memcpy(stack.cstrBuf, cstr, len + 1);
+			return stack;
+		}
+		std::shared_ptr<HeapAllocData> heap = std::make_shared<HeapAllocData>();
+		heap->data.strByteLength = len;
+		heap->cCapacity = len + 1;
+		heap->cstrBuf = std::make_unique<char[]>(len + 1);
+		memcpy(heap->cstrBuf.get(), cstr, len + 1);
+		return heap;
+	}
+
+	static const char* cstr(const String& str) {
+		if (std::holds_alternative<StackAllocData>(str)) {
+			return std::get<StackAllocData>(str).cstrBuf;
+		} else if (std::holds_alternative<std::shared_ptr<HeapAllocData>>(str)) {
+			return std::get<std::shared_ptr<HeapAllocData>>(str)->cstrBuf.get();
+		} else {
+			return std::get<LiteralData>(str).cstrBuf;
+		}
+	}
+}
+
+// Mostly identifiers, with the occasional sentence, similar to what ends up in maps and configs.
+static std::vector<std::string> sampleStrings(int count) {
+	std::mt19937 rng(1234);
+	std::vector<std::string> ret;
+	ret.reserve(count);
+	for (int i = 0; i < count; i++) {
+		int len = rng() % 8 == 0 ? 32 + rng() % 96 : 4 + rng() % 16;
+		std::string str;
+		for (int j = 0; j < len; j++) {
+			str += (char)('a' + rng() % 26);
+		}
+		ret.emplace_back(std::move(str));
+	}
+	return ret;
+}
+
+BENCHMARK_SUITE("String benchmarks") {
+
+TEST_CASE("Layout") {
+	pgeCout << "sizeof(String): " << sizeof(String) << " bytes" << std::endl;
+	pgeCout << "sizeof(legacy String): " << sizeof(Legacy::String) << " bytes" << std::endl;
+
+	std::vector<std::string> samples = sampleStrings(4096);
+	std::vector<String> strings;
+	std::vector<Legacy::String> legacyStrings;
+	for (const std::string& sample : samples) {
+		strings.emplace_back(sample);
+		legacyStrings.emplace_back(Legacy::make(sample.c_str()));
+	}
+
+	benchmark("cstr", 100'000'000, [&](int i) { return (u64)strings[i & 4095].cstr()[0]; });
+	benchmark("legacy cstr", 100'000'000, [&](int i) { return (u64)Legacy::cstr(legacyStrings[i & 4095])[0]; });
+
+	benchmark("Copying 4096 strings", 1'000, [&](int) { std::vector<String> copy = strings; return copy.size(); });
+	benchmark("Copying 4096 legacy strings", 1'000, [&](int) { std::vector<Legacy::String> copy = legacyStrings; return copy.size(); });
+}
+
+TEST_CASE("Splitting") {
+	std::vector<std::string> samples = sampleStrings(256);
+	String line;
+	for (const std::string& sample : samples) {
+		line += String(sample) + String(",");
+	}
+	benchmark("Splitting into 256 strings", 10'000, [&](int) { return line.split(",", true).size(); });
+}
+
+TEST_CASE("Joining") {
+	std::vector<std::string> samples = sampleStrings(4096);
+	std::vector<String> strings(samples.begin(), samples.end());
+	String separator = ", ";
+	benchmark("Joining by appending", 1'000, [&](int) {
+		String ret = strings[0];
+		for (int i : Range(1, (int)strings.size())) {
+			ret += separator + strings[i];
+		}
+		return ret.byteLength();
+	});
+	benchmark("join", 1'000, [&](int) { return String::join(strings, separator).byteLength(); });
+	String name = "Wall_Brick_Worn_01";
+	benchmark("Concatenating with +", 1'000'000, [&](int) { return (name + " (" + separator + name + ")").byteLength(); });
+	benchmark("concat", 1'000'000, [&](int) { return String::concat(name, " (", separator, name, ")").byteLength(); });
+}
+
+TEST_CASE("Case insensitivity") {
+	String path = "GFX/Map/Textures/Wall_Brick_Worn_01_Normal.png";
+	String lookup = "gfx/map/textures/wall_brick_worn_01_normal.PNG";
+	String text = L"Gr\u00FC\u00DFe an alle, die diesen ziemlich langen Text in Gro\u00DFbuchstaben sehen wollen";
+	benchmark("toUpper ASCII", 1'000'000, [&](int) { return path.toUpper().byteLength(); });
+	benchmark("toLower non-ASCII", 1'000'000, [&](int) { return text.toLower().byteLength(); });
+	benchmark("equalsIgnoreCase ASCII", 10'000'000, [&](int) { return path.equalsIgnoreCase(lookup); });
+	benchmark("equalsIgnoreCase non-ASCII", 1'000'000, [&](int) { return text.equalsIgnoreCase(text.toUpper()); });
+}
+
+TEST_CASE("Hashing while appending") {
+	// Like building a key character by character and looking it up after every step.
+	benchmark("Appending and hashing 1024 characters", 1'000, [&](int) {
+		String str;
+		u64 hash = 0;
+		for (int i : Range(1024)) {
+			str += (char16)('a' + i % 26);
+			hash ^= str.getHashCode();
+		}
+		return hash;
+	});
+}
+
+TEST_CASE("Number conversion") {
+	// What config and asset loaders go through: many short integers and floats.
+	std::mt19937 rng(1234);
+	std::vector<String> integers;
+	std::vector<String> floats;
+	std::vector<double> values;
+	for (int i : Range(4096)) {
+		integers.emplace_back(String::from((int)(rng() % 2'000'000) - 1'000'000));
+		values.emplace_back((double)(rng() % 1'000'000) / (1 + i % 1000));
+		floats.emplace_back(String::from(values.back()));
+	}
+	benchmark("to<int>", 10'000'000, [&](int i) { return (u64)integers[i & 4095].to<int>(); });
+	benchmark("strtol", 10'000'000, [&](int i) { return (u64)strtol(integers[i & 4095].cstr(), nullptr, 10); });
+	benchmark("to<double>", 10'000'000, [&](int i) { return (u64)floats[i & 4095].to<double>(); });
+	benchmark("strtod", 10'000'000, [&](int i) { return (u64)strtod(floats[i & 4095].cstr(), nullptr); });
+	benchmark("from(double)", 1'000'000, [&](int i) { return (u64)String::from(values[i & 4095]).byteLength(); });
+	benchmark("snprintf %f", 1'000'000, [&](int i) {
+		char buf[512];
+		return (u64)snprintf(buf, sizeof(buf), "%f", values[i & 4095]);
+	});
+}
+
+TEST_CASE("Formatting") {
+	String file = "Src/Graphics/GraphicsOGL3.cpp";
+	String function = "void PGE::GraphicsOGL3::swap()";
+	benchmark("Concatenating", 1'000'000, [&](int i) {
+		return (file + '(' + String::from(i) + ',' + String::from(i & 63) + "): " + function).byteLength();
+	});
+	benchmark("format", 1'000'000, [&](int i) {
+		return String::format<"{}({},{}): {}">(file, i, i & 63, function).byteLength();
+	});
+}
+
+TEST_CASE("Sorting") {
+	// Asset paths share long directory prefixes.
+	std::vector<std::string> samples = sampleStrings(200'000);
+	const char* directories[] = { "GFX/Map/Textures/", "GFX/Items/", "SFX/Ambient/", "Data/" };
+	std::vector<String> paths;
+	for (int i : Range((int)samples.size())) {
+		paths.emplace_back(String(directories[i % 4]) + String(samples[i]));
+	}
+	benchmark("std::sort by compare", 5, [&](int) {
+		std::vector<String> copy = paths;
+		std::sort(copy.begin(), copy.end(), [](const String& a, const String& b) { return a.compare(b) < 0; });
+		return copy.front().byteLength();
+	});
+	benchmark("String::sort", 5, [&](int) {
+		std::vector<String> copy = paths;
+		String::sort(copy);
+		return copy.front().byteLength();
+	});
+}
+
+TEST_CASE("Regex") {
+	// Pulling a version number out of a log line, like what regexMatch used to do on every call.
+	String line = "[12:04:55] Info: Loaded GFX/Map/Textures/Wall_Brick_Worn_01.png (v2.18, 1024x1024)";
+	std::vector<char16> wideLine = line.wstr();
+	Regex version("v\\d+\\.\\d+");
+	benchmark("Regex::find", 1'000'000, [&](int) { return (u64)version.find(line)->byteLength(); });
+	benchmark("regexMatch", 1'000'000, [&](int) { return (u64)line.regexMatch("v\\d+\\.\\d+").byteLength(); });
+	benchmark("std::wregex", 10'000, [&](int) {
+		std::wcmatch match;
+		std::regex_search(wideLine.data(), match, std::wregex(L"v\\d+\\.\\d+"));
+		return (u64)match.length();
+	});
+	String as = String("a").repeat(100'000);
+	benchmark("Regex::find on input that backtracking chokes on", 100, [&](int) { return (u64)Regex("(a|aa)*b").find(as).has_value(); });
+	// Grows with the square of the length, each match only ends the first alternative at the end of the text.
+	Regex singleA("a+b|a");
+	for (int length : { 1'000, 2'000, 4'000, 8'000 }) {
+		String prefix = as.substr(0, length);
+		benchmark(("Regex::findAll, a+b|a on " + std::to_string(length) + " a's").c_str(), 5, [&](int) { return (u64)singleA.findAll(prefix).size(); });
+	}
+}
+
+TEST_CASE("Transcoding") {
+	String ascii = String("GFX/Map/Textures/Wall_Brick_Worn_01_Normal.png ").repeat(64);
+	String cyrillic = String(L"\u0422\u0435\u043A\u0441\u0442\u0443\u0440\u044B \u0441\u0442\u0435\u043D\u044B ").repeat(128);
+	String cjk = String(L"\u58C1\u306E\u30C6\u30AF\u30B9\u30C1\u30E3 ").repeat(256);
+	for (const String* text : { &ascii, &cyrillic, &cjk }) {
+		std::vector<char16> wide = text->wstr();
+		String label = String::concat(" (", String::from(text->byteLength()), " bytes, ", String::from(text->length()), " characters)");
+		benchmark(String::concat("wstr", label).cstr(), 100'000, [&](int) { return text->wstr().size(); });
+		benchmark(String::concat("Per character", label).cstr(), 100'000, [&](int) {
+			std::vector<char16> chars;
+			for (char16 ch : *text) {
+				chars.emplace_back(ch);
+			}
+			return chars.size();
+		});
+		benchmark(String::concat("From char16", label).cstr(), 100'000, [&](int) { return (u64)String(wide.data()).byteLength(); });
+		benchmark(String::concat("Appending per character", label).cstr(), 100'000, [&](int) {
+			StringBuilder builder;
+			for (char16 ch : std::span(wide.data(), wide.size() - 1)) {
+				builder.append(ch);
+			}
+			return (u64)builder.byteLength();
+		});
+	}
+}
+
+TEST_CASE("Unicode lookups") {
+	// Every char16 in a scrambled order, so that the branch predictor can't learn the sequence.
+	std::vector<char16> chars(0x10000);
+	for (int i : Range(0x10000)) {
+		chars[i] = (char16)(i * 40503);
+	}
+	benchmark("isSpace", 100'000'000, [&](int i) { return Unicode::isSpace(chars[i & 0xFFFF]); });
+	benchmark("isDigit", 100'000'000, [&](int i) { return Unicode::isDigit(chars[i & 0xFFFF]); });
+	String text = L"float4 main(PS_INPUT input) : SV_TARGET {\n\treturn tex.Sample(smp, input.uv) * input.color; // \u00DCbung\n}\n";
+	benchmark("Counting spaces in shader source", 1'000'000, [&](int) {
+		int count = 0;
+		for (char16 ch : text) {
+			count += Unicode::isSpace(ch);
+		}
+		return count;
+	});
+}
+
+}
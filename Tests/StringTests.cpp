@@ -1,8 +1,19 @@
 #include "Util.h"
 
 #include <PGE/String/String.h>
+#include <PGE/String/Key.h>
+#include <PGE/String/InternedString.h>
+#include <PGE/String/StringBuilder.h>
+#include <PGE/String/Regex.h>
+#include <PGE/String/Unicode.h>
+#include <PGE/Math/Hasher.h>
 #include <PGE/Exception/Exception.h>
 
+#include <thread>
+#include <random>
+#include <cmath>
+#include <bit>
+
 using namespace PGE;
 
 TEST_SUITE("Strings") {
@@ -24,6 +35,20 @@ TEST_CASE("Lengths") {
 		u8"Ok, I'll also make it include special characters like  and  and idfk \u2764 (it's a heart)", 176, 172);
 }
 
+TEST_CASE("Long lengths") {
+	String a; int count;
+	SUBCASE_PARAMETERIZE(
+		(a, "A", u8"\u00E4", u8"\u2764", u8"A\u00E4\u2764"),
+		(count, 1, 15, 16, 17, 31, 32, 33, 300, 5000)
+	);
+
+	// Constructing from a raw pointer discards the known length.
+	String unknownLength = String(a.repeat(count).cstr());
+	CHECK(unknownLength.end().getPosition() == a.length() * count);
+	CHECK((unknownLength.end() - 1).getPosition() == a.length() * count - 1);
+	CHECK(unknownLength.length() == a.length() * count);
+}
+
 TEST_CASE("Basic iterator tests") {
 	String a;
 	SUBCASE_PARAMETERIZE((a, "A", u8"", L"\u2764"));
@@ -162,6 +187,126 @@ TEST_CASE("Uppercase explicit") {
 	CHECK(String(u8"j !@#$%^\u2764&*() ano\u2764").toUpper() == u8"J !@#$%^\u2764&*() ANO\u2764");
 }
 
+TEST_CASE("Case conversion of long strings") {
+	// Long enough for whole ASCII blocks, with non-ASCII in between and on the edges.
+	String mixed = L"The Quick Brown Fox [@`{] Jumps \u00FCber the lazy dog, \u00C4RGER \u00FCber \u00C4rger and that's it \u00D6";
+	CHECK(mixed.toUpper() == L"THE QUICK BROWN FOX [@`{] JUMPS \u00DCBER THE LAZY DOG, \u00C4RGER \u00DCBER \u00C4RGER AND THAT'S IT \u00D6");
+	CHECK(mixed.toLower() == L"the quick brown fox [@`{] jumps \u00FCber the lazy dog, \u00E4rger \u00FCber \u00E4rger and that's it \u00F6");
+	CHECK(mixed.toUpper().length() == mixed.length());
+}
+
+TEST_CASE("Equals ignore case") {
+	CHECK(String("textures/Wall_Brick_01.PNG").equalsIgnoreCase("TEXTURES/wall_brick_01.png"));
+	CHECK(!String("textures/Wall_Brick_01.PNG").equalsIgnoreCase("TEXTURES/wall_brick_02.png"));
+	CHECK(!String("textures/Wall_Brick_01.PNG").equalsIgnoreCase("textures/Wall_Brick_01.PN"));
+	CHECK(!String("textures/Wall_Brick_01.PN").equalsIgnoreCase("textures/Wall_Brick_01.PNG"));
+	CHECK(!String("textures/Wall_Brick_01.PNG").equalsIgnoreCase("textures/Wall_Brick_01.PNG_"));
+	// ASCII and non-ASCII letters that fold to the same thing.
+	CHECK(String(L"Kelvin \u212A and long s \u017F after a long ASCII prefix").equalsIgnoreCase(L"kELVIN k AND LONG S s AFTER A LONG ascii PREFIX"));
+	CHECK(String(L"a long enough prefix, then Stra\u00DFe").equalsIgnoreCase("A LONG ENOUGH PREFIX, THEN STRASSE"));
+	CHECK(!String(L"a long enough prefix, then Stra\u00DFe").equalsIgnoreCase("A LONG ENOUGH PREFIX, THEN STRASS"));
+	CHECK(!String(L"\u00D6S").equalsIgnoreCase(L"\u00F6ss"));
+	CHECK(String().equalsIgnoreCase(""));
+}
+
+TEST_CASE("Unicode tables") {
+	// Hashed the same way the generator hashes the Unicode data it built the tables from.
+	u64 digest = 0xCBF29CE484222325u;
+	auto feed = [&](u8 b) { digest = (digest ^ b) * 0x100000001B3u; };
+	for (int i : Range(0x10000)) {
+		char16 ch = (char16)i;
+		feed((Unicode::isSpace(ch) ? 1 : 0) | (Unicode::isDigit(ch) ? 2 : 0));
+		// The null character and the noncharacters at the end can't be put into a string.
+		if (ch == 0 || ch >= 0xFFFE) { continue; }
+		String str(ch);
+		for (const String& mapped : { str.foldCase(), str.toUpper(), str.toLower() }) {
+			for (char16 unit : mapped.wstr()) {
+				feed((u8)unit);
+				feed((u8)(unit >> 8));
+			}
+		}
+	}
+	CHECK(digest == Unicode::TABLE_DIGEST);
+
+	// At least one character for every kind of entry in the tables.
+	struct CaseMapping {
+		char16 ch;
+		const char16* upper;
+		const char16* lower;
+	};
+	const CaseMapping CASE_MAPPINGS[] = {
+		{ L'a', L"A", L"a" },
+		{ L'Z', L"Z", L"z" },
+		{ L'~', L"~", L"~" },
+		{ L'\u00B5', L"\u039C", L"\u00B5" },
+		{ L'\u00DF', L"\u1E9E", L"\u00DF" },
+		{ L'\u00C0', L"\u00C0", L"\u00E0" },
+		{ L'\u00FF', L"\u0178", L"\u00FF" },
+		{ L'\u0130', L"\u0130", L"i\u0307" },
+		{ L'\u0131', L"I", L"\u0131" },
+		{ L'\u0149', L"\u02BCN", L"\u0149" },
+		{ L'\u017F', L"S", L"\u017F" },
+		{ L'\u01C5', L"\u01C4", L"\u01C6" },
+		{ L'\u0390', L"\u0399\u0308\u0301", L"\u0390" },
+		{ L'\u03A3', L"\u03A3", L"\u03C3" },
+		{ L'\u03C2', L"\u03A3", L"\u03C2" },
+		{ L'\u0401', L"\u0401", L"\u0451" },
+		{ L'\u0587', L"\u0535\u0552", L"\u0587" },
+		{ L'\u10A0', L"\u10A0", L"\u2D00" },
+		{ L'\u1E9E', L"\u1E9E", L"\u00DF" },
+		{ L'\u1F80', L"\u1F08\u0399", L"\u1F80" },
+		{ L'\u2126', L"\u2126", L"\u03C9" },
+		{ L'\u212A', L"\u212A", L"k" },
+		{ L'\u24B6', L"\u24B6", L"\u24D0" },
+		{ L'\u4E00', L"\u4E00", L"\u4E00" },
+		{ L'\uFB03', L"FFI", L"\uFB03" },
+		{ L'\uFF21', L"\uFF21", L"\uFF41" },
+	};
+	for (const CaseMapping& mapping : CASE_MAPPINGS) {
+		CHECK(String(mapping.ch).toUpper() == String(mapping.upper));
+		CHECK(String(mapping.ch).toLower() == String(mapping.lower));
+	}
+
+	CHECK(String(L"\u00B5").equalsIgnoreCase(L"\u03BC"));
+	CHECK(String(L"\u00DF").equalsIgnoreCase("ss"));
+	CHECK(String(L"\u1E9E").equalsIgnoreCase("SS"));
+	CHECK(String(L"\u03C2").equalsIgnoreCase(L"\u03A3"));
+	CHECK(String(L"\u0130").equalsIgnoreCase(L"i\u0307"));
+	CHECK(String(L"\u0149").equalsIgnoreCase(L"\u02BCn"));
+	CHECK(String(L"\u01C5").equalsIgnoreCase(L"\u01C6"));
+	CHECK(String(L"\u1F80").equalsIgnoreCase(L"\u1F00\u03B9"));
+	CHECK(String(L"\u2126").equalsIgnoreCase(L"\u03C9"));
+	CHECK(String(L"\uFB03").equalsIgnoreCase("FFI"));
+	CHECK(!String(L"\u0131").equalsIgnoreCase("i"));
+	CHECK(String(L"Stra\u00DFe \u212A\u03A3\u03C2").foldCase() == L"strasse k\u03C3\u03C3");
+
+	struct Properties {
+		char16 ch;
+		bool space;
+		bool digit;
+	};
+	const Properties PROPERTIES[] = {
+		{ L'\t', true, false },
+		{ L' ', true, false },
+		{ L'\u0085', true, false },
+		{ L'\u00A0', true, false },
+		{ L'\u2028', true, false },
+		{ L'\u3000', true, false },
+		{ L'0', false, true },
+		{ L'7', false, true },
+		{ L'a', false, false },
+		{ L'\u0667', false, false },
+		{ L'\uFF10', false, false },
+	};
+	for (const Properties& properties : PROPERTIES) {
+		CHECK(Unicode::isSpace(properties.ch) == properties.space);
+		CHECK(Unicode::isDigit(properties.ch) == properties.digit);
+	}
+
+	CHECK(String(L"\u00DF\uFB03").toUpper() == L"\u1E9EFFI");
+	CHECK(String(L"\u0130").toLower() == L"i\u0307");
+}
+
 TEST_CASE("Replace explicit") {
 	String a = "pulsegoop";
 	CHECK(a.replace("goop", "gun") == "pulsegun");
@@ -179,6 +324,510 @@ TEST_CASE("Replace explicit") {
 	CHECK(String().replace("", "|") == "|");
 }
 
+TEST_CASE("Replace overlapping") {
+	CHECK(String("aaa").replace("aa", "b") == "ba");
+	CHECK(String("aaaa").replace("aa", "b") == "bb");
+	CHECK(String("abababa").replace("aba", "|") == "|b|");
+}
+
+TEST_CASE("Find explicit") {
+	String a = u8"pulse\u00E4gun\u00E4pulse";
+	CHECK(a.contains(u8"\u00E4g"));
+	CHECK(!a.contains("pulsa"));
+	CHECK(a.findFirst("pulse").getPosition() == 0);
+	CHECK(a.findFirst("pulse", 1).getPosition() == 10);
+	CHECK(a.findFirst(u8"\u00E4").getPosition() == 5);
+	CHECK(a.findFirst(u8"\u00E4", 6).getPosition() == 9);
+	CHECK(a.findFirst("gun") + 3 == a.findFirst(u8"\u00E4", 6));
+	CHECK(a.findFirst("nope") == a.end());
+	CHECK(a.findLast("pulse").getPosition() == 10);
+	CHECK(a.findLast("pulse", 5).getPosition() == 0);
+	CHECK(a.findLast(u8"\u00E4").getPosition() == 9);
+	CHECK(a.findLast("nope") == a.rend());
+	String empty;
+	CHECK(empty.findFirst("a") == empty.end());
+	CHECK(empty.findLast("a") == empty.rend());
+	CHECK_THROWS_PGE(a.findLast(""));
+}
+
+TEST_CASE("Find long") {
+	String filler = String(u8"xy\u2764z").repeat(100);
+	String needle = "needle";
+	for (int i : Range(40)) {
+		needle += String::from(i);
+	}
+	String a = filler + needle + filler + needle + filler;
+	int first = filler.length();
+	int last = 2 * filler.length() + needle.length();
+	String n;
+	SUBCASE_PARAMETERIZE((n, needle, needle.substr(0, 2), needle.substr(0, 17), needle.substr(0, 33)));
+	CHECK(a.findFirst(n).getPosition() == first);
+	CHECK(a.findFirst(n, first + 1).getPosition() == last);
+	CHECK(a.findLast(n).getPosition() == last);
+	CHECK(a.findLast(n, a.length() - last).getPosition() == first);
+	// The filler starts with an x, so only a character missing from it makes the needle not occur.
+	CHECK(a.findFirst(n + "#") == a.end());
+	CHECK(a.findLast(n + "#") == a.rend());
+	CHECK(a.replace(n, "") == filler + needle.substr(n.length()) + filler + needle.substr(n.length()) + filler);
+	CHECK(a.split(n, true) == std::vector<String>{ filler, needle.substr(n.length()) + filler, needle.substr(n.length()) + filler });
+}
+
+TEST_CASE("Compile time keys") {
+	constexpr String::Key POSITION = "position"_key;
+	CHECK(POSITION.hash == String::Key("position").hash);
+	CHECK("a longer key that spans more than one hashing stripe"_key.hash == String::Key("a longer key that spans more than one hashing stripe").hash);
+	CHECK("p\xC3\xB6sition"_key.hash == String::Key(u8"p\u00F6sition").hash);
+	CHECK(""_key.hash == String::Key(String()).hash);
+	CHECK(POSITION.hash != "positio"_key.hash);
+}
+
+TEST_CASE("Interning") {
+	InternedString a = String("uniformName").intern();
+	InternedString b = InternedString(String("uniform") + "Name");
+	CHECK(a == b);
+	CHECK(&a.str() == &b.str());
+	CHECK(a.str() == "uniformName");
+	CHECK(a.getHashCode() == String("uniformName").getHashCode());
+	CHECK(a != String("uniformname").intern());
+	CHECK(InternedString() == String().intern());
+
+	std::unordered_map<InternedString, int> map;
+	map.emplace(a, 1);
+	CHECK(map.find(b)->second == 1);
+	CHECK(map.find(String("uniformName"))->second == 1);
+	CHECK(map.find("uniformName"_key)->second == 1);
+	CHECK(map.find(String("uniformNam")) == map.end());
+}
+
+TEST_CASE("Concurrent interning") {
+	constexpr int THREAD_COUNT = 8;
+	std::vector<InternedString> results[THREAD_COUNT];
+	std::vector<std::thread> threads;
+	for (int t : Range(THREAD_COUNT)) {
+		threads.emplace_back([&results, t]() {
+			for (int i : Range(1000)) {
+				results[t].emplace_back(String("concurrent" + String::from(i)).intern());
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	for (int t : Range(1, THREAD_COUNT)) {
+		CHECK(results[t] == results[0]);
+	}
+}
+
+TEST_CASE("Compile time literals") {
+	String a = "p\xC3\xA4lse"_PGE;
+	CHECK(a.byteLength() == 6);
+	CHECK(a.length() == 5);
+	CHECK(a.getHashCode() == String(u8"p\u00E4lse").getHashCode());
+	CHECK(a == u8"p\u00E4lse");
+	CHECK(""_PGE.isEmpty());
+}
+
+TEST_CASE("Literals from many threads") {
+	// Every evaluation of the literal refers to the same static data, copying it must never write to it.
+	std::vector<std::thread> threads;
+	std::vector<int> lengths(8);
+	std::vector<u64> hashes(8);
+	for (int t : Range(8)) {
+		threads.emplace_back([&lengths, &hashes, t]() {
+			for (PGE_IT : Range(1000)) {
+				String copy = "a literal shared between threads"_PGE;
+				lengths[t] = copy.length();
+				hashes[t] = copy.getHashCode();
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	for (int t : Range(8)) {
+		CHECK(lengths[t] == 32);
+		CHECK(hashes[t] == String("a literal shared between threads").getHashCode());
+	}
+}
+
+TEST_CASE("Shared strings from many threads") {
+	constexpr int THREAD_COUNT = 4;
+	// Heap allocated and non-ASCII, so that the length, hash code and random access index all have to be computed lazily.
+	String base = String(L"Asset \u00E4\u00F6\u00FC \u65E5\u672C ").repeat(40);
+	for (int round : Range(50)) {
+		const String shared = base + String::from(round);
+		std::vector<int> lengths(THREAD_COUNT);
+		std::vector<u64> hashes(THREAD_COUNT);
+		std::vector<char16> chars(THREAD_COUNT);
+		std::vector<std::thread> threads;
+		for (int t : Range(THREAD_COUNT)) {
+			// Half of the threads read the string itself, the other half their own copy.
+			threads.emplace_back([&, t]() {
+				String copy = shared;
+				const String& str = t % 2 == 0 ? shared : copy;
+				chars[t] = *str.charAt(500 + t);
+				hashes[t] = str.getHashCode();
+				int count = 0;
+				for (String::Iterator it = str.begin(); it != str.end(); ++it) {
+					count++;
+				}
+				lengths[t] = count == str.length() ? count : -1;
+			});
+		}
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+		String fresh(shared.cstr());
+		for (int t : Range(THREAD_COUNT)) {
+			CHECK(lengths[t] == fresh.length());
+			CHECK(hashes[t] == fresh.getHashCode());
+			CHECK(chars[t] == *fresh.charAt(500 + t));
+		}
+
+		// Appending to a string whose hash is known carries the hashing progress over.
+		String appended = shared;
+		appended += base;
+		CHECK(appended.getHashCode() == String(appended.cstr()).getHashCode());
+	}
+}
+
+TEST_CASE("String builder") {
+	StringBuilder builder;
+	CHECK(builder.build() == "");
+
+	builder.append(u'a');
+	builder.append(u'\u00F6');
+	builder.append(u'\u20AC');
+	builder.appendByte('b');
+	builder.appendBytes(std::span("c\xC3\xA4", 3));
+	builder += "d";
+	CHECK(builder.length() == 7);
+	CHECK(builder.byteLength() == 11);
+	String built = builder.build();
+	CHECK(built == u8"a\u00F6\u20ACbc\u00E4d");
+	CHECK(built.length() == 7);
+	CHECK(built.getHashCode() == String(u8"a\u00F6\u20ACbc\u00E4d").getHashCode());
+	CHECK(builder.isEmpty());
+
+	// Grows past the inline buffer of short strings.
+	String expected;
+	for (int i : Range(1000)) {
+		builder.append((char16)(u'a' + i % 26));
+		expected += (char16)(u'a' + i % 26);
+	}
+	String longBuilt = builder.build();
+	CHECK(longBuilt == expected);
+	CHECK(longBuilt.length() == 1000);
+
+	// Continues where the string ended.
+	StringBuilder continued(std::move(longBuilt));
+	continued += "!";
+	CHECK(continued.build() == expected + "!");
+
+	StringBuilder reserved(100);
+	reserved.append(expected);
+	reserved.clear();
+	reserved.append(u'x');
+	std::vector<char16> invalidUnits(20, u'y');
+	invalidUnits[17] = (char16)0xFFFF;
+	CHECK_THROWS_AS(reserved.appendUtf16(invalidUnits), Exception);
+	CHECK(reserved.length() == 1);
+	CHECK(reserved.build() == "x");
+}
+
+TEST_CASE("String views") {
+	String a = "  pulse,g\xC3\xB6,,gun  ";
+	StringView trimmed = a.trimView();
+	CHECK(trimmed == "pulse,g\xC3\xB6,,gun");
+	CHECK(trimmed.data() == a.cstr() + 2);
+	CHECK(trimmed.length() == 13);
+	CHECK(String(trimmed) == a.trim());
+
+	std::vector<StringView> parts = trimmed.split(",", false);
+	REQUIRE(parts.size() == 4);
+	CHECK(parts[1] == "g\xC3\xB6");
+	CHECK(parts[2].isEmpty());
+	CHECK(trimmed.split(",", true).size() == 3);
+	CHECK(a.split(",", false) == std::vector<String>{ "  pulse", u8"g\u00F6", "", "gun  " });
+	CHECK(a.splitView(",", false).size() == a.split(",", false).size());
+
+	CHECK(trimmed.findFirst("g").getPosition() == 6);
+	CHECK(trimmed.findLast("g").getPosition() == 10);
+	CHECK(trimmed.findLast("x") == trimmed.end());
+	CHECK(trimmed.contains("\xC3\xB6,"));
+	CHECK(trimmed.substr(6, 2) == "g\xC3\xB6");
+	CHECK(*(trimmed.begin() + 7) == u'\u00F6');
+	CHECK(*(--trimmed.end()) == u'n');
+	CHECK(*(trimmed.end() + -3) == u'g');
+	CHECK(*(trimmed.begin() - -7) == u'\u00F6');
+	StringView::Iterator it = trimmed.end();
+	it += -4;
+	it -= -1;
+	CHECK(it.getPosition() == 10);
+	CHECK(a.substrView(2, 5) == "pulse");
+
+	CHECK(StringView("   ").trim().isEmpty());
+	CHECK(StringView("a").compare("b") == std::weak_ordering::less);
+	CHECK(StringView("ab").compare("a") == std::weak_ordering::greater);
+
+	// Hashes and keys match those of equal strings.
+	StringView gun = parts[3];
+	CHECK(gun.getHashCode() == String("gun").getHashCode());
+	CHECK(String::Key(gun).hash == "gun"_key.hash);
+	std::unordered_map<InternedString, int> map;
+	map.emplace(String("gun").intern(), 1);
+	CHECK(map.find(gun)->second == 1);
+	CHECK(map.find(parts[0]) == map.end());
+}
+
+TEST_CASE("Codepoint indexing") {
+	String mixed = String(u8"a\u00F6\u20AC").repeat(100);
+	std::vector<char16> chars = mixed.wstr();
+	for (int i : Range(mixed.length())) {
+		REQUIRE(*mixed.charAt(i) == chars[i]);
+		CHECK(mixed.charAt(i).getPosition() == i);
+	}
+	CHECK(mixed.charAt(300) == mixed.end());
+	CHECK(mixed.charAt(-1) == mixed.end());
+
+	CHECK(*(mixed.begin() + 100) == u'\u00F6');
+	CHECK((mixed.begin() + 100 - 40).getPosition() == 60);
+	CHECK(mixed.end() - 300 == mixed.begin());
+	CHECK(*(mixed.rbegin() + 100) == u'\u00F6');
+	CHECK(mixed.rbegin() + 300 == mixed.rend());
+	CHECK(mixed.substr(150, 3) == u8"a\u00F6\u20AC");
+	CHECK_THROWS_PGE(mixed.begin() + 301);
+	CHECK_THROWS_PGE(mixed.rbegin() + 301);
+
+	// Appending has to invalidate the index.
+	mixed += String(u8"\u00DF").repeat(40);
+	CHECK(*mixed.charAt(320) == u'\u00DF');
+
+	String ascii = String("abc").repeat(100);
+	CHECK(*ascii.charAt(299) == u'c');
+	CHECK(ascii.substr(100, 3) == "bca");
+}
+
+TEST_CASE("Short and long strings") {
+	String str;
+	for (int i = 0; i < 64; i++) {
+		String copy = str;
+		str += L'a';
+		// Appending never affects copies, whether the characters were inline or shared.
+		CHECK(copy.byteLength() == i);
+		CHECK(str.byteLength() == i + 1);
+		CHECK(str.cstr()[i + 1] == '\0');
+	}
+	String moved = std::move(str);
+	CHECK(moved.length() == 64);
+	CHECK(str.isEmpty());
+
+	String literal = "a literal that is too long to be stored inline"_PGE;
+	String grown = literal;
+	grown += L'\u00F6';
+	CHECK(grown.length() == literal.length() + 1);
+	CHECK(grown.getHashCode() == (literal + L'\u00F6').getHashCode());
+
+	String shortened = "short"_PGE;
+	shortened += L'!';
+	CHECK(shortened == "short!");
+}
+
+TEST_CASE("Hashing while appending") {
+	String str;
+	String other;
+	for (int i = 0; i < 200; i++) {
+		str += i % 7 == 0 ? L'\u00F6' : (char16)('a' + i % 26);
+		other += String(str.substr(i / 2));
+		// The hash code of a grown string has to be the same as hashing all its bytes again.
+		CHECK(str.getHashCode() == Hasher::getHash(std::span((const byte*)str.cstr(), str.byteLength())));
+		if (i % 3 == 0) {
+			CHECK(other.getHashCode() == Hasher::getHash(std::span((const byte*)other.cstr(), other.byteLength())));
+		}
+	}
+	String combined(str, other);
+	CHECK(combined.getHashCode() == Hasher::getHash(std::span((const byte*)combined.cstr(), combined.byteLength())));
+	String copy = str;
+	copy += L'!';
+	CHECK(str.getHashCode() == Hasher::getHash(std::span((const byte*)str.cstr(), str.byteLength())));
+	CHECK(copy.getHashCode() == (str + L'!').getHashCode());
+}
+
+TEST_CASE("Number conversion") {
+	bool success;
+	CHECK(String("-2147483648").to<int>() == std::numeric_limits<int>::min());
+	String("2147483648").to<int>(success);
+	CHECK(!success);
+	String("12a").to<int>(success);
+	CHECK(!success);
+	String("").to<int>(success);
+	CHECK(!success);
+	CHECK(String("1234567890123456789").to<u64>() == 1234567890123456789u);
+	CHECK(String("fF").hexToInt<u32>() == 255);
+
+	CHECK(String("0.1").to<double>() == 0.1);
+	CHECK(String("-1.5e3").to<float>() == -1500.f);
+	CHECK(String("2.2250738585072011e-308").to<double>() == 2.2250738585072011e-308);
+	CHECK(String("4.9e-324").to<double>() == 4.9e-324);
+	CHECK(String("1e400").to<double>() == std::numeric_limits<double>::infinity());
+	CHECK(String("-Infinity").to<double>() == -std::numeric_limits<double>::infinity());
+	CHECK(String(L"\u221E").to<float>() == std::numeric_limits<float>::infinity());
+	CHECK(std::isnan(String("nan").to<double>()));
+	String("1.5f").to<float>(success);
+	CHECK(!success);
+
+	CHECK(String::from(0.1) == "0.1");
+	CHECK(String::from(1.0f) == "1");
+	CHECK(String::from(1e300) == "1e+300");
+	std::mt19937_64 rng(1234);
+	for (int i = 0; i < 10000; i++) {
+		double d = std::bit_cast<double>(rng());
+		if (std::isfinite(d)) {
+			CHECK(String::from(d).to<double>() == d);
+		}
+	}
+}
+
+TEST_CASE("Format") {
+	String name = "world";
+	CHECK(String::format<"Hello, {}!">(name) == "Hello, world!");
+	CHECK(String::format<"{}{}{}">(1, -2ll, 3u) == "1-23");
+	CHECK(String::format<"{{{}}}">(0.5) == "{0.5}");
+	CHECK(String::format<"{} {} {} {}">('a', L'\u00F6', true, "literal") == L"a \u00F6 true literal");
+	CHECK(String::format<"no arguments">() == "no arguments");
+	String longer = String::format<"{} and {} make a string that doesn't fit inline">(StringView("views"), 1.5f);
+	CHECK(longer == "views and 1.5 make a string that doesn't fit inline");
+	CHECK(longer.length() == longer.byteLength());
+
+	StringBuilder builder;
+	String::formatTo<"({}, {})">(builder, 1, 2);
+	String::formatTo<"\xC3\xA4{}">(builder, L'\u00F6');
+	CHECK(builder.length() == 8);
+	CHECK(builder.build() == L"(1, 2)\u00E4\u00F6");
+}
+
+TEST_CASE("Codepoint order") {
+	std::vector<String> strs = {
+		L"\u00F6l", "zebra", "GFX/Map/Textures/b.png", "GFX/Map/Textures/a.png", L"\u20AC", "GFX/Map/",
+		"", L"\u00E4", "GFX/Map/Textures/a.png.bak", "Zebra",
+	};
+	// UTF-8 bytes are in the same order as the codepoints they encode.
+	CHECK(String(L"\u00F6").compare(L"\u20AC") < 0);
+	CHECK(String("z").compare(L"\u00E4") < 0);
+	CHECK(String("GFX/Map/").compare("GFX/Map/Textures") < 0);
+
+	std::vector<String> sorted = strs;
+	String::sort(sorted);
+	CHECK(sorted == std::vector<String>{
+		"", "GFX/Map/", "GFX/Map/Textures/a.png", "GFX/Map/Textures/a.png.bak", "GFX/Map/Textures/b.png",
+		"Zebra", "zebra", L"\u00E4", L"\u00F6l", L"\u20AC",
+	});
+	for (const String& a : strs) {
+		CHECK(String::OrderedKey(a).getString() == a);
+		for (const String& b : strs) {
+			CHECK((String::OrderedKey(a) <=> String::OrderedKey(b)) == a.compare(b));
+		}
+	}
+}
+
+TEST_CASE("Regex") {
+	// Leftmost match, preferring earlier alternatives and greedy repetitions like ECMAScript.
+	CHECK(Regex("a|ab").find("xab")->str() == "a");
+	CHECK(Regex("ab|a").find("xab")->str() == "ab");
+	CHECK(Regex("a+").find("baaa")->str() == "aaa");
+	CHECK(Regex("a+?").find("baaa")->str() == "a");
+	CHECK(Regex("<.*?>").find("<a><b>")->str() == "<a>");
+	CHECK(Regex("x{2,3}").find("xxxxx")->str() == "xxx");
+	CHECK(Regex("(?:ab){2}").find("ababab")->str() == "abab");
+	CHECK(Regex("[0-9]+\\.\\d*").find("v12.50")->str() == "12.50");
+	CHECK(Regex("^b").find("ab") == std::nullopt);
+	String aba = "aba";
+	CHECK(Regex("a$").find(aba)->data() == aba.cstr() + 2);
+	CHECK(Regex("x*").find("abc")->isEmpty());
+
+	CHECK(Regex("[a-z]+\\d").matches("abc1"));
+	CHECK(Regex("a|ab").matches("ab"));
+	CHECK(!Regex("a|ab").matches("abc"));
+
+	// Classes match whole codepoints.
+	String text = L"gr\u00FC\u00DFe \u20AC5, \u00FCbel";
+	CHECK(Regex(String(L"[\u00E0-\u00FF]+")).find(text)->str() == L"\u00FC");
+	CHECK(Regex("[^a-z ]+").find(text)->str() == L"\u00FC\u00DF");
+	CHECK(Regex(String(L"\u20AC\\d")).find(text)->str() == L"\u20AC5");
+	CHECK(Regex("\\s").findAll(text).size() == 2);
+	CHECK(Regex("\\w+").findAll(text).size() == 4);
+
+	CHECK(Regex("x*").replace("abc", "-") == "-a-b-c-");
+	CHECK(Regex("a*").replace("baaac", "-") == "-b--c-");
+	CHECK(Regex(String(L"\u00DF|e")).replace(text, "ss") == L"gr\u00FCssss \u20AC5, \u00FCbssl");
+
+	CHECK_THROWS_PGE(Regex("(a"));
+	CHECK_THROWS_PGE(Regex("a)"));
+	CHECK_THROWS_PGE(Regex("[a"));
+	CHECK_THROWS_PGE(Regex("*a"));
+	CHECK_THROWS_PGE(Regex("a{3,2}"));
+	CHECK_THROWS_PGE(Regex("(a)\\1"));
+
+	// Would take exponential time with backtracking.
+	String as = String("a").repeat(10'000);
+	CHECK(Regex("(a*)*b").find(as) == std::nullopt);
+	CHECK(Regex("(a|aa)+$").matches(as));
+	CHECK(as.regexMatch("a{3}") == "aaa");
+	// Every match settles on the second alternative only after the first one ran to the end of the text.
+	String thousand = as.substr(0, 1000);
+	std::vector<StringView> singles = Regex("a+b|a").findAll(thousand);
+	CHECK(singles.size() == 1000);
+	CHECK(singles.back().data() == thousand.cstr() + 999);
+	CHECK(singles.back().byteLength() == 1);
+}
+
+TEST_CASE("Concatenation") {
+	String name = L"M\u00FCller";
+	String concatenated = String::concat("Name: ", name, StringView("; id: 42", 5), String::from(42), "");
+	CHECK(concatenated == L"Name: M\u00FCller; id:42");
+	CHECK(concatenated.length() == 19);
+	CHECK(String::concat(name) == name);
+	CHECK(String::concat("", "").isEmpty());
+	CHECK(String::concat(String("a").repeat(100), "b").byteLength() == 101);
+
+	std::vector<String> parts = { "", name, "", L"\u20AC" };
+	String joined = String::join(parts, ", ");
+	CHECK(joined == L", M\u00FCller, , \u20AC");
+	CHECK(joined.length() == 13);
+	CHECK(String::join(std::vector<String>(), ", ").isEmpty());
+	CHECK(String::join(std::vector<String>{ name }, ", ") == name);
+	CHECK(String::join(std::vector<String>{ "", "" }, "") == "");
+}
+
+TEST_CASE("UTF-16 transcoding") {
+	// Long enough to go through whole blocks of every kind, and mixed so that blocks have to fall back.
+	const char16* pieces[] = { L"plain ASCII text ", L"\u00E4\u00F6\u00FC\u00DF\u0410\u0411\u0412\u0413", L"\u65E5\u672C\u8A9E\u306E\u30C6\u30AD\u30B9\u30C8", L"a\u00E9\u4E2D" };
+	std::vector<char16> units;
+	String expected;
+	for (int i : Range(40)) {
+		const char16* piece = pieces[i * 7 % 4];
+		for (int j = 0; piece[j] != L'\0'; j++) {
+			units.push_back(piece[j]);
+			expected += piece[j];
+		}
+		units.push_back(L'\0');
+		String str(units.data());
+		units.pop_back();
+		CHECK(str == expected);
+		CHECK(str.length() == (int)units.size());
+		CHECK(str.byteLength() == Unicode::measureUtf8(units));
+
+		std::vector<char16> wide = str.wstr();
+		CHECK(wide.back() == L'\0');
+		CHECK(std::equal(units.begin(), units.end(), wide.begin(), wide.end() - 1));
+
+		StringBuilder builder;
+		builder.appendUtf16(units);
+		CHECK(builder.build() == expected);
+	}
+	CHECK_THROWS_PGE(StringBuilder().appendUtf16(std::vector<char16>(16, (char16)0xFFFF)));
+}
+
 TEST_CASE("Substring explicit") {
 	String a = L"pulsegop";
 	CHECK(a.substr(5) == L"gop");
@@ -0,0 +1,81 @@
+#include "Util.h"
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <cstdio>
+
+#include <PGE/File/TextReader.h>
+#include <PGE/Types/Range.h>
+
+using namespace PGE;
+
+static FilePath writeTestFile(std::string_view content) {
+    static constexpr const char* NAME = "TextReaderTest.txt";
+    std::ofstream(NAME, std::ios::binary).write(content.data(), content.size());
+    return FilePath::fromStr(NAME);
+}
+
+TEST_SUITE("Text reader") {
+
+TEST_CASE("UTF-8 lines") {
+    FilePath file = writeTestFile("first\r\ng\xC3\xB6\xE2\x82\xAC\n\rlast");
+    TextReader reader(file);
+    CHECK(reader.readLine() == "first");
+    String line = reader.readLine();
+    CHECK(line == "g\xC3\xB6\xE2\x82\xAC");
+    CHECK(line.length() == 3);
+    CHECK(reader.readLine() == "last");
+    CHECK(reader.endOfFile());
+    reader.earlyClose();
+    std::remove(file.str().cstr());
+}
+
+TEST_CASE("UTF-16 lines") {
+    // Both with a byte order mark, the second line has a character that takes three bytes in UTF-8.
+    FilePath file = writeTestFile(std::string_view("\xFF\xFE" "a\0b\0\r\0\n\0\xAC\x20\xF6\0\n\0", 16));
+    TextReader littleEndian(file);
+    CHECK(littleEndian.readLine() == "ab");
+    String line = littleEndian.readLine();
+    CHECK(line == "\xE2\x82\xAC\xC3\xB6");
+    CHECK(line.length() == 2);
+    littleEndian.readLine();
+    CHECK(littleEndian.endOfFile());
+    littleEndian.earlyClose();
+
+    file = writeTestFile(std::string_view("\xFE\xFF" "\0a\0\r\0b", 8));
+    TextReader bigEndian(file);
+    CHECK(bigEndian.readLine() == "a");
+    CHECK(bigEndian.readLine() == "b");
+    CHECK(bigEndian.endOfFile());
+    bigEndian.earlyClose();
+    std::remove(file.str().cstr());
+}
+
+TEST_CASE("Invalid UTF-16 leaves the destination alone") {
+    // Long enough for the destination to not be stored inline.
+    std::string content = "\xFF\xFE";
+    for (PGE_IT : Range(40)) {
+        content.append("a\0", 2);
+    }
+    content.append("\n\0b\0\xFF\xFF", 6);
+    FilePath file = writeTestFile(content);
+    TextReader reader(file);
+    String dest = reader.readLine();
+    CHECK_THROWS_AS(reader.readLine(dest), Exception);
+    CHECK(dest == String("a").repeat(40));
+    reader.earlyClose();
+    std::remove(file.str().cstr());
+}
+
+TEST_CASE("Malformed UTF-8 leaves the destination alone") {
+    FilePath file = writeTestFile("a long enough line to not be stored inline\nbad \xC3\x28\n");
+    TextReader reader(file);
+    String dest = reader.readLine();
+    CHECK_THROWS_AS(reader.readLine(dest), Exception);
+    CHECK(dest == "a long enough line to not be stored inline");
+    reader.earlyClose();
+    std::remove(file.str().cstr());
+}
+
+}